@@ -144,14 +144,17 @@ if(ENABLE_ECL_OUTPUT)
           src/opm/output/eclipse/CreateLogiHead.cpp
           src/opm/output/eclipse/WellDataSerializers.cpp
           src/opm/output/eclipse/DoubHEAD.cpp
+          src/opm/output/eclipse/EclOutput.cpp
           src/opm/output/eclipse/EclipseGridInspector.cpp
           src/opm/output/eclipse/EclipseIO.cpp
           src/opm/output/eclipse/InteHEAD.cpp
           src/opm/output/eclipse/LinearisedOutputTable.cpp
           src/opm/output/eclipse/LogiHEAD.cpp
+          src/opm/output/eclipse/RestartFile.cpp
           src/opm/output/eclipse/RestartIO.cpp
           src/opm/output/eclipse/Summary.cpp
           src/opm/output/eclipse/SummaryState.cpp
+          src/opm/output/eclipse/SummaryWriter.cpp
           src/opm/output/eclipse/Tables.cpp
           src/opm/output/eclipse/RegionCache.cpp
           src/opm/output/eclipse/RestartValue.cpp
@@ -237,6 +240,8 @@ if(ENABLE_ECL_OUTPUT)
           tests/test_CharArrayNullTerm.cpp
           tests/test_compareSummary.cpp
           tests/test_EclFilesComparator.cpp
+          tests/test_EclOutput.cpp
+          tests/test_RestartFile.cpp
           tests/test_EclipseIO.cpp
           tests/test_DoubHEAD.cpp
           tests/test_InteHEAD.cpp
@@ -247,6 +252,7 @@ if(ENABLE_ECL_OUTPUT)
           tests/test_RFT.cpp
           tests/test_Solution.cpp
           tests/test_Summary.cpp
+          tests/test_SummaryWriter.cpp
           tests/test_Tables.cpp
           tests/test_Wells.cpp
           tests/test_WindowedArray.cpp
@@ -274,15 +280,20 @@ if(ENABLE_ECL_OUTPUT)
 endif()
 
 list (APPEND EXAMPLE_SOURCE_FILES
+      examples/cubic_benchmark.cpp
+      examples/table_linear_benchmark.cpp
 )
 if(ENABLE_ECL_INPUT)
   list (APPEND EXAMPLE_SOURCE_FILES
     examples/opmi.cpp
     examples/opmpack.cpp
+    examples/vfp_benchmark.cpp
   )
 endif()
 if(ENABLE_ECL_OUTPUT)
   list(APPEND EXAMPLE_SOURCE_FILES
+          examples/restart_write_benchmark.cpp
+          examples/summary_write_benchmark.cpp
           examples/test_util/compareECL.cpp
           examples/test_util/compareSummary.cpp
       )
@@ -362,6 +373,7 @@ if(ENABLE_ECL_INPUT)
        opm/parser/eclipse/EclipseState/InitConfig/InitConfig.hpp
        opm/parser/eclipse/EclipseState/InitConfig/Equil.hpp
        opm/parser/eclipse/EclipseState/Util/Value.hpp
+       opm/parser/eclipse/EclipseState/Util/NameIndex.hpp
        opm/parser/eclipse/EclipseState/Util/OrderedMap.hpp
        opm/parser/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp
        opm/parser/eclipse/EclipseState/Grid/GridDims.hpp
@@ -445,6 +457,7 @@ if(ENABLE_ECL_INPUT)
        opm/parser/eclipse/EclipseState/AquiferCT.hpp
        opm/parser/eclipse/EclipseState/Schedule/TimeMap.hpp
        opm/parser/eclipse/EclipseState/Schedule/VFPInjTable.hpp
+       opm/parser/eclipse/EclipseState/Schedule/VFPInterpolation.hpp
        opm/parser/eclipse/EclipseState/Schedule/VFPProdTable.hpp
        opm/parser/eclipse/EclipseState/Schedule/Well.hpp
        opm/parser/eclipse/EclipseState/Schedule/WellInjectionProperties.hpp
@@ -499,6 +512,7 @@ if(ENABLE_ECL_OUTPUT)
         opm/output/eclipse/AggregateWellData.hpp
         opm/output/eclipse/CharArrayNullTerm.hpp
         opm/output/eclipse/DoubHEAD.hpp
+        opm/output/eclipse/EclOutput.hpp
         opm/output/eclipse/EclipseGridInspector.hpp
         opm/output/eclipse/EclipseIO.hpp
         opm/output/eclipse/EclipseIOUtil.hpp
@@ -506,10 +520,12 @@ if(ENABLE_ECL_OUTPUT)
         opm/output/eclipse/LogiHEAD.hpp
         opm/output/eclipse/LinearisedOutputTable.hpp
         opm/output/eclipse/RegionCache.hpp
+        opm/output/eclipse/RestartFile.hpp
         opm/output/eclipse/RestartIO.hpp
         opm/output/eclipse/RestartValue.hpp
         opm/output/eclipse/Summary.hpp
         opm/output/eclipse/SummaryState.hpp
+        opm/output/eclipse/SummaryWriter.hpp
         opm/output/eclipse/Tables.hpp
         opm/output/eclipse/WindowedArray.hpp
         opm/output/eclipse/WriteRestartHelpers.hpp
@@ -0,0 +1,102 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Times MonotCubicInterpolator evaluation: one point at a time, as a
+  batch of sorted arguments and as a batch of unsorted arguments.
+
+  Usage: cubic_benchmark [num_datapoints] [num_evaluations]
+*/
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <opm/common/utility/numeric/MonotCubicInterpolator.hpp>
+
+
+namespace {
+
+    template <class Function>
+    double timeIt(const std::string& label, size_t num_evaluations, Function&& function) {
+        const auto start = std::chrono::steady_clock::now();
+        const double checksum = function();
+        const auto end = std::chrono::steady_clock::now();
+        const double seconds = std::chrono::duration<double>(end - start).count();
+
+        std::cout << label << seconds << " s, "
+                  << 1.0e9 * seconds / num_evaluations << " ns/evaluation"
+                  << "  (checksum " << checksum << ")" << std::endl;
+        return seconds;
+    }
+
+}
+
+
+int main(int argc, char** argv) {
+    const size_t num_datapoints = (argc > 1) ? std::atoi(argv[1]) : 100;
+    const size_t num_evaluations = (argc > 2) ? std::atoi(argv[2]) : 1000000;
+
+    std::vector<double> x(num_datapoints), f(num_datapoints);
+    for (size_t i = 0; i < num_datapoints; ++i) {
+        x[i] = static_cast<double>(i) / (num_datapoints - 1);
+        f[i] = std::sqrt(x[i]) + x[i] * x[i];
+    }
+    const Opm::MonotCubicInterpolator interp(x, f);
+
+    std::vector<double> sorted_args(num_evaluations), unsorted_args(num_evaluations);
+    for (size_t i = 0; i < num_evaluations; ++i) {
+        sorted_args[i] = -0.1 + 1.2 * i / num_evaluations;
+        unsorted_args[i] = -0.1 + 1.2 * ((i * 7919) % num_evaluations) / num_evaluations;
+    }
+
+    std::cout << "Data points: " << num_datapoints << "  Evaluations: " << num_evaluations << std::endl;
+
+    timeIt("Single point, sorted:   ", num_evaluations, [&]() {
+            double sum = 0.0;
+            for (const double arg : sorted_args)
+                sum += interp.evaluate(arg);
+            return sum;
+        });
+
+    timeIt("Single point, unsorted: ", num_evaluations, [&]() {
+            double sum = 0.0;
+            for (const double arg : unsorted_args)
+                sum += interp.evaluate(arg);
+            return sum;
+        });
+
+    timeIt("Batch, sorted:          ", num_evaluations, [&]() {
+            double sum = 0.0;
+            for (const double value : interp.evaluate(sorted_args))
+                sum += value;
+            return sum;
+        });
+
+    timeIt("Batch, unsorted:        ", num_evaluations, [&]() {
+            double sum = 0.0;
+            for (const double value : interp.evaluate(unsorted_args))
+                sum += value;
+            return sum;
+        });
+
+    return 0;
+}
@@ -0,0 +1,119 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Compares the throughput of writing restart solution fields with
+  libecl - one ecl_kw per field, filled with the values converted to
+  output units and written with ecl_kw_fwrite() - and with the native
+  EclOutput writer. A number of fields (default 20) of a number of
+  cells (default 5000000) are written in float precision; the
+  throughput is reported in GB/s of keyword data.
+
+  Usage: restart_write_benchmark [num_cells] [num_fields] [repeats] [basename]
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <opm/parser/eclipse/Units/UnitSystem.hpp>
+#include <opm/output/eclipse/EclOutput.hpp>
+
+#include <ert/ecl/FortIO.hpp>
+#include <ert/ecl/ecl_kw.h>
+#include <ert/ecl/ecl_type.h>
+#include <ert/ecl/fortio.h>
+
+
+namespace {
+
+    using measure = Opm::UnitSystem::measure;
+
+    void write_ecl(const std::string& filename,
+                   const std::vector<std::vector<double>>& fields,
+                   const Opm::UnitSystem& units) {
+        ERT::FortIO fortio(filename, std::ios_base::out);
+        std::vector<double> block;
+        for (size_t field = 0; field < fields.size(); ++field) {
+            const auto& data = fields[field];
+            const auto name = "FIELD" + std::to_string(field);
+            ecl_kw_type* kw = ecl_kw_alloc(name.c_str(), data.size(), ECL_FLOAT);
+            float* values = ecl_kw_get_float_ptr(kw);
+
+            block = data;
+            units.from_si(measure::pressure, block);
+            for (size_t i = 0; i < block.size(); ++i)
+                values[i] = block[i];
+
+            ecl_kw_fwrite(kw, fortio.get());
+            ecl_kw_free(kw);
+        }
+        fortio.close();
+    }
+
+    void write_native(const std::string& filename,
+                      const std::vector<std::vector<double>>& fields,
+                      const Opm::UnitSystem& units) {
+        Opm::out::EclOutput output(filename);
+        for (size_t field = 0; field < fields.size(); ++field)
+            output.writeFromSI("FIELD" + std::to_string(field), fields[field], units, measure::pressure, false);
+
+        output.close();
+    }
+
+    template <typename Write>
+    double time(Write write, size_t repeats) {
+        double best = 0;
+        for (size_t i = 0; i < repeats; ++i) {
+            const auto start = std::chrono::steady_clock::now();
+            write();
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (i == 0 || seconds < best)
+                best = seconds;
+        }
+        return best;
+    }
+}
+
+
+int main(int argc, char** argv) {
+    const size_t num_cells = (argc > 1) ? std::atoi(argv[1]) : 5000000;
+    const size_t num_fields = (argc > 2) ? std::atoi(argv[2]) : 20;
+    const size_t repeats = (argc > 3) ? std::atoi(argv[3]) : 3;
+    const std::string basename = (argc > 4) ? argv[4] : "RESTART_BENCHMARK";
+
+    const auto units = Opm::UnitSystem::newMETRIC();
+    std::vector<std::vector<double>> fields(num_fields, std::vector<double>(num_cells));
+    for (size_t field = 0; field < num_fields; ++field)
+        for (size_t cell = 0; cell < num_cells; ++cell)
+            fields[field][cell] = 1.0e7 + 0.5 * cell + field;
+
+    const double gigabytes = 4.0 * num_cells * num_fields / 1.0e9;
+    const double ecl_seconds = time([&]() { write_ecl(basename + "_ECL.X0000", fields, units); }, repeats);
+    const double native_seconds = time([&]() { write_native(basename + "_NATIVE.X0000", fields, units); }, repeats);
+
+    std::cout << "Cells: " << num_cells << "  Fields: " << num_fields
+              << "  Data: " << gigabytes << " GB" << std::endl;
+    std::cout << "libecl:     " << ecl_seconds << " s, " << gigabytes / ecl_seconds << " GB/s" << std::endl;
+    std::cout << "EclOutput:  " << native_seconds << " s, " << gigabytes / native_seconds << " GB/s" << std::endl;
+
+    return 0;
+}
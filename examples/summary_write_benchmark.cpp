@@ -0,0 +1,82 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Times the native summary writer: a number of vectors (default 50000)
+  are written for a number of ministeps (default 10000), with ten
+  ministeps per report step, to a unified summary file. As in the
+  simulator every ministep is followed by a call to write(). The time
+  per ministep should stay constant as the file grows.
+
+  Usage: summary_write_benchmark [num_steps] [num_vectors] [flush_interval] [basename]
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+
+#include <opm/output/eclipse/SummaryWriter.hpp>
+
+
+int main(int argc, char** argv) {
+    const size_t num_steps = (argc > 1) ? std::atoi(argv[1]) : 10000;
+    const size_t num_vectors = (argc > 2) ? std::atoi(argv[2]) : 50000;
+    const size_t flush_interval = (argc > 3) ? std::atoi(argv[3]) : 1;
+    const std::string basename = (argc > 4) ? argv[4] : "SUMMARY_BENCHMARK";
+    const size_t steps_per_report = 10;
+
+    Opm::out::SummaryWriter writer(basename, true, std::time_t(0), 100, 100, 10, 1);
+    writer.setFlushInterval(flush_interval);
+    for (size_t i = 0; i < num_vectors; ++i)
+        writer.addVector("WOPR", "W" + std::to_string(i), 0, "SM3/DAY");
+
+    const auto start = std::chrono::steady_clock::now();
+    auto last = start;
+    double first_half = 0.0;
+    for (size_t step = 0; step < num_steps; ++step) {
+        writer.addTimestep(1 + step / steps_per_report, 0.1 * step);
+        for (size_t i = 0; i < num_vectors; ++i)
+            writer.set(i + 1, float(step + i));
+
+        writer.write();
+
+        if (step + 1 == num_steps / 2) {
+            last = std::chrono::steady_clock::now();
+            first_half = std::chrono::duration<double>(last - start).count();
+        }
+    }
+    writer.flush();
+    const auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    const double second_half = std::chrono::duration<double>(end - last).count();
+    const double megabytes = 4.0 * (num_vectors + 1) * num_steps / (1024 * 1024);
+
+    std::cout << "Ministeps: " << num_steps << "  Vectors: " << num_vectors
+              << "  Flush interval: " << flush_interval << std::endl;
+    std::cout << "Total:        " << seconds << " s, "
+              << 1.0e3 * seconds / num_steps << " ms/ministep, "
+              << megabytes / seconds << " MB/s" << std::endl;
+    std::cout << "First half:   " << 1.0e3 * first_half / (num_steps / 2) << " ms/ministep" << std::endl;
+    std::cout << "Second half:  " << 1.0e3 * second_half / (num_steps - num_steps / 2) << " ms/ministep" << std::endl;
+
+    return 0;
+}
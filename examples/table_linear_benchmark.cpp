@@ -0,0 +1,117 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Times UniformTableLinear and NonuniformTableLinear evaluation of values
+  and derivatives, one point at a time and as a batch.
+
+  Usage: table_linear_benchmark [num_datapoints] [num_evaluations]
+*/
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <opm/common/utility/numeric/NonuniformTableLinear.hpp>
+#include <opm/common/utility/numeric/UniformTableLinear.hpp>
+
+
+namespace {
+
+    template <class Function>
+    double timeIt(const std::string& label, size_t num_evaluations, Function&& function) {
+        const auto start = std::chrono::steady_clock::now();
+        const double checksum = function();
+        const auto end = std::chrono::steady_clock::now();
+        const double seconds = std::chrono::duration<double>(end - start).count();
+
+        std::cout << label << seconds << " s, "
+                  << 1.0e9 * seconds / num_evaluations << " ns/evaluation"
+                  << "  (checksum " << checksum << ")" << std::endl;
+        return seconds;
+    }
+
+
+    double sum(const std::vector<double>& values) {
+        double s = 0.0;
+        for (const double value : values)
+            s += value;
+        return s;
+    }
+
+
+    template <class Table>
+    void timeTable(const std::string& name, const Table& table, const std::vector<double>& args) {
+        const size_t num_evaluations = args.size();
+        std::vector<double> result(num_evaluations);
+
+        timeIt(name + " single point:      ", num_evaluations, [&]() {
+                double s = 0.0;
+                for (const double arg : args)
+                    s += table(arg);
+                return s;
+            });
+
+        timeIt(name + " batch:             ", num_evaluations, [&]() {
+                table.evaluate(args.data(), result.data(), int(num_evaluations));
+                return sum(result);
+            });
+
+        timeIt(name + " derivative single: ", num_evaluations, [&]() {
+                double s = 0.0;
+                for (const double arg : args)
+                    s += table.derivative(arg);
+                return s;
+            });
+
+        timeIt(name + " derivative batch:  ", num_evaluations, [&]() {
+                table.derivative(args.data(), result.data(), int(num_evaluations));
+                return sum(result);
+            });
+    }
+
+}
+
+
+int main(int argc, char** argv) {
+    const size_t num_datapoints = (argc > 1) ? std::atoi(argv[1]) : 100;
+    const size_t num_evaluations = (argc > 2) ? std::atoi(argv[2]) : 1000000;
+
+    std::vector<double> x(num_datapoints), y(num_datapoints);
+    for (size_t i = 0; i < num_datapoints; ++i) {
+        const double s = static_cast<double>(i) / (num_datapoints - 1);
+        x[i] = s * s;
+        y[i] = std::exp(-s);
+    }
+    const Opm::UniformTableLinear<double> uniform(0.0, 1.0, y);
+    const Opm::NonuniformTableLinear<double> nonuniform(x, y);
+
+    std::vector<double> args(num_evaluations);
+    for (size_t i = 0; i < num_evaluations; ++i)
+        args[i] = -0.1 + 1.2 * ((i * 7919) % num_evaluations) / num_evaluations;
+
+    std::cout << "Data points: " << num_datapoints << "  Evaluations: " << num_evaluations << std::endl;
+    timeTable("Uniform   ", uniform, args);
+    timeTable("Nonuniform", nonuniform, args);
+
+    return 0;
+}
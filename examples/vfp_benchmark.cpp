@@ -0,0 +1,134 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Times the VFPPROD evaluation API with a synthetic table: a number of
+  wells (default 1000) each solve bhp(flo) = target_bhp for the rate
+  with Newton iterations (default 100), evaluating the whole set of
+  wells in one batch per iteration. Finally the THP giving the target
+  BHP is found for every well.
+
+  Usage: vfp_benchmark [num_wells] [num_iterations]
+*/
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <opm/parser/eclipse/EclipseState/Schedule/VFPProdTable.hpp>
+
+
+namespace {
+
+    std::vector<double> linspace(double start, double stop, size_t num) {
+        std::vector<double> values(num);
+        for (size_t i = 0; i < num; ++i)
+            values[i] = start + (stop - start) * i / (num - 1);
+        return values;
+    }
+
+
+    Opm::VFPProdTable makeTable() {
+        const auto flo = linspace(1.0e-3, 0.1, 20);
+        const auto thp = linspace(10.0e5, 100.0e5, 10);
+        const auto wfr = linspace(0.0, 0.9, 8);
+        const auto gfr = linspace(50.0, 500.0, 8);
+        const auto alq = linspace(0.0, 3.0, 4);
+
+        Opm::VFPProdTable::extents shape;
+        shape[0] = thp.size();
+        shape[1] = wfr.size();
+        shape[2] = gfr.size();
+        shape[3] = alq.size();
+        shape[4] = flo.size();
+        Opm::VFPProdTable::array_type data(shape);
+
+        for (size_t t = 0; t < thp.size(); ++t)
+            for (size_t w = 0; w < wfr.size(); ++w)
+                for (size_t g = 0; g < gfr.size(); ++g)
+                    for (size_t a = 0; a < alq.size(); ++a)
+                        for (size_t f = 0; f < flo.size(); ++f)
+                            data[t][w][g][a][f] = 1.2 * thp[t]
+                                                + 50.0e5 * (1.0 + wfr[w]) / (1.0 + 0.001 * gfr[g])
+                                                - 2.0e5 * alq[a]
+                                                + 3.0e9 * flo[f] * flo[f];
+
+        return Opm::VFPProdTable(1, 2000.0,
+                                 Opm::VFPProdTable::FLO_OIL,
+                                 Opm::VFPProdTable::WFR_WCT,
+                                 Opm::VFPProdTable::GFR_GOR,
+                                 Opm::VFPProdTable::ALQ_UNDEF,
+                                 flo, thp, wfr, gfr, alq, data);
+    }
+
+}
+
+
+int main(int argc, char** argv) {
+    const size_t num_wells = (argc > 1) ? std::atoi(argv[1]) : 1000;
+    const size_t num_iterations = (argc > 2) ? std::atoi(argv[2]) : 100;
+    const auto table = makeTable();
+
+    std::vector<double> flo(num_wells), thp(num_wells), wfr(num_wells), gfr(num_wells), alq(num_wells);
+    std::vector<double> target_bhp(num_wells);
+    for (size_t i = 0; i < num_wells; ++i) {
+        flo[i] = 0.01;
+        thp[i] = 10.0e5 + 80.0e5 * i / num_wells;
+        wfr[i] = 0.9 * ((i * 7) % num_wells) / num_wells;
+        gfr[i] = 50.0 + 450.0 * ((i * 13) % num_wells) / num_wells;
+        alq[i] = 3.0 * ((i * 17) % num_wells) / num_wells;
+        target_bhp[i] = 1.2 * thp[i] + 60.0e5;
+    }
+
+    const auto newton_start = std::chrono::steady_clock::now();
+    double max_residual = 0.0;
+    for (size_t iter = 0; iter < num_iterations; ++iter) {
+        const auto bhp = table.bhp(flo, thp, wfr, gfr, alq);
+
+        max_residual = 0.0;
+        for (size_t i = 0; i < num_wells; ++i) {
+            const double residual = bhp[i].value - target_bhp[i];
+            max_residual = std::max(max_residual, std::fabs(residual));
+            if (bhp[i].dflo != 0.0)
+                flo[i] -= residual / bhp[i].dflo;
+        }
+    }
+    const auto newton_end = std::chrono::steady_clock::now();
+
+    double thp_sum = 0.0;
+    for (size_t i = 0; i < num_wells; ++i)
+        thp_sum += table.thp(flo[i], wfr[i], gfr[i], alq[i], target_bhp[i]);
+    const auto thp_end = std::chrono::steady_clock::now();
+
+    const double newton_seconds = std::chrono::duration<double>(newton_end - newton_start).count();
+    const double thp_seconds = std::chrono::duration<double>(thp_end - newton_end).count();
+    const double num_evaluations = static_cast<double>(num_wells) * num_iterations;
+
+    std::cout << "Wells: " << num_wells << "  Newton iterations: " << num_iterations << std::endl;
+    std::cout << "BHP evaluation:  " << newton_seconds << " s, "
+              << 1.0e9 * newton_seconds / num_evaluations << " ns/evaluation"
+              << "  (max residual " << max_residual << " Pa)" << std::endl;
+    std::cout << "THP inversion:   " << thp_seconds << " s, "
+              << 1.0e6 * thp_seconds / num_wells << " us/well"
+              << "  (mean THP " << thp_sum / num_wells << " Pa)" << std::endl;
+
+    return 0;
+}
@@ -4,8 +4,8 @@
 #define _MONOTCUBICINTERPOLATOR_H
 
 #include <vector>
-#include <map>
 #include <string>
+#include <utility>
 
 /*
   MonotCubicInterpolator
@@ -206,6 +206,16 @@ class MonotCubicInterpolator {
    */
    double evaluate(double x) const;
 
+   /**
+      @param x x values
+      Returns f(x) for all the given x values, as evaluate(double).
+      The search for each interval starts from the interval of the
+      previous x value, so x values sorted in increasing order are
+      handled in a single sweep through the data points.
+      @return f(x) for all the given x values
+   */
+   std::vector<double> evaluate(const std::vector<double> & x) const;
+
    /**
       @param x x value
       @param errorestimate_output
@@ -235,7 +245,7 @@ class MonotCubicInterpolator {
    */
    std::pair<double,double> getMinimumX() const {
        // Easy since the data is sorted on x:
-       return *data.begin();
+       return std::make_pair(xdata.front(), fdata.front());
    }
 
    /**
@@ -246,7 +256,7 @@ class MonotCubicInterpolator {
    */
    std::pair<double,double> getMaximumX() const {
        // Easy since the data is sorted on x:
-       return *data.rbegin();
+       return std::make_pair(xdata.back(), fdata.back());
    }
 
    /**
@@ -299,16 +309,8 @@ class MonotCubicInterpolator {
 
       @return True if f(x) is strictly monotone, else False
    */
-   bool isStrictlyMonotone() {
-
-       /* Use cached value if it can be trusted */
-       if (strictlyMonotoneCached) {
-           return strictlyMonotone;
-       }
-       else {
-           computeInternalFunctionData();
-           return strictlyMonotone;
-       }
+   bool isStrictlyMonotone() const {
+       return strictlyMonotone;
    }
 
    /**
@@ -317,13 +319,7 @@ class MonotCubicInterpolator {
       @return True if f(x) is monotone, else False
    */
    bool isMonotone() const {
-       if (monotoneCached) {
-           return monotone;
-       }
-       else {
-           computeInternalFunctionData();
-           return monotone;
-       }
+       return monotone;
    }
    /**
       Determines if the current function-value-data is strictly
@@ -332,16 +328,8 @@ class MonotCubicInterpolator {
 
       @return True if f(x) is strictly increasing, else False
    */
-   bool isStrictlyIncreasing() {
-
-       /* Use cached value if it can be trusted */
-       if (strictlyMonotoneCached) {
-           return (strictlyMonotone && strictlyIncreasing);
-       }
-       else {
-           computeInternalFunctionData();
-           return (strictlyMonotone && strictlyIncreasing);
-       }
+   bool isStrictlyIncreasing() const {
+       return (strictlyMonotone && strictlyIncreasing);
    }
 
    /**
@@ -350,13 +338,7 @@ class MonotCubicInterpolator {
       @return True if f(x) is monotone and increasing, else False
    */
    bool isMonotoneIncreasing() const {
-       if (monotoneCached) {
-           return (monotone && increasing);
-       }
-       else {
-           computeInternalFunctionData();
-           return (monotone && increasing);
-       }
+       return (monotone && increasing);
    }
    /**
       Determines if the current function-value-data is strictly
@@ -365,16 +347,8 @@ class MonotCubicInterpolator {
 
       @return True if f(x) is strictly decreasing, else False
    */
-   bool isStrictlyDecreasing() {
-
-       /* Use cached value if it can be trusted */
-       if (strictlyMonotoneCached) {
-           return (strictlyMonotone && strictlyDecreasing);
-       }
-       else {
-           computeInternalFunctionData();
-           return (strictlyMonotone && strictlyDecreasing);
-       }
+   bool isStrictlyDecreasing() const {
+       return (strictlyMonotone && strictlyDecreasing);
    }
 
    /**
@@ -383,13 +357,7 @@ class MonotCubicInterpolator {
       @return True if f(x) is monotone and decreasing, else False
    */
    bool isMonotoneDecreasing() const {
-       if (monotoneCached) {
-           return (monotone && decreasing);
-       }
-       else {
-           computeInternalFunctionData();
-           return (monotone && decreasing);
-       }
+       return (monotone && decreasing);
    }
 
 
@@ -434,7 +402,7 @@ class MonotCubicInterpolator {
      @return Number of datapoint pairs in this object
    */
    int getSize() const {
-       return data.size();
+       return xdata.size();
    }
 
     /**
@@ -494,29 +462,23 @@ class MonotCubicInterpolator {
 
 private:
 
-   // Data structure to store x- and f-values
-   std::map<double, double> data;
-
-   // Data structure to store x- and d-values
-   mutable std::map<double, double> ddata;
-
-
-   // Storage containers for precomputed interpolation data
-   //   std::vector<double> dvalues; // derivatives in Hermite interpolation.
-
-   // Flag to determine whether the boolean strictlyMonotone can be
-   // trusted.
-   mutable bool strictlyMonotoneCached;
-   mutable bool monotoneCached; /* only monotone, not stricly montone */
+   // Data points sorted on x, stored as separate arrays of x-values,
+   // f-values and derivatives (d-values). The derivatives and the
+   // monotonicity flags below are recomputed whenever the data points
+   // change, so that all const member functions are free of side
+   // effects. ddata is empty if there are fewer than two data points.
+   std::vector<double> xdata;
+   std::vector<double> fdata;
+   std::vector<double> ddata;
 
-   mutable bool strictlyMonotone;
-   mutable bool monotone;
+   bool strictlyMonotone = false;
+   bool monotone = false; /* only monotone, not stricly montone */
 
-   // if strictlyMonotone is true (and can be trusted), the two next are meaningful
-   mutable bool strictlyDecreasing;
-   mutable bool strictlyIncreasing;
-   mutable bool decreasing;
-   mutable bool increasing;
+   // if strictlyMonotone is true, the two next are meaningful
+   bool strictlyDecreasing = false;
+   bool strictlyIncreasing = false;
+   bool decreasing = false;
+   bool increasing = false;
 
 
    /* Hermite basis functions, t \in [0,1] ,
@@ -538,16 +500,30 @@ private:
    }
 
 
-   void computeInternalFunctionData() const ;
+   /**
+       Sorts the data points on x; for duplicate x-values the last
+       point is kept.
+   */
+   void sortData(std::vector<std::pair<double,double> > & xf);
+
+   void computeInternalFunctionData();
+
+   void computeMonotoneness();
+
+   /**
+      Returns f(x) given the index of the first data point with
+      x-value >= x, i.e. the result of a lower bound search.
+   */
+   double evaluateAt(std::size_t upper, double x) const;
 
    /**
        Computes initial derivative values using centered (second order) difference
        for internal datapoints, and one-sided derivative for endpoints
 
-       The internal datastructure map<double,double> ddata is populated by this method.
+       The internal derivative array ddata is populated by this method.
    */
 
-   void computeSimpleDerivatives() const ;
+   void computeSimpleDerivatives();
 
 
    /**
@@ -556,7 +532,7 @@ private:
       done according to the algorithm of Fritsch and Carlsson 1980,
       see Section 4, especially the two last lines.
    */
-  void adjustDerivativesForMonotoneness() const ;
+  void adjustDerivativesForMonotoneness();
 
    /**
        Checks if the coefficient alpha and beta is in
@@ -71,6 +71,30 @@ namespace Opm
         /// @return f'(x)
         double derivative(const double x) const;
 
+        /// @brief Evaluate the values at all x, as operator()(double).
+        ///        The interval search is a fixed-length bisection without
+        ///        branches, so the cost does not depend on the data.
+        /// @param x array of domain values
+        /// @param y output array of range values, f(x[i])
+        /// @param num_x the number of values in x and y.
+        void evaluate(const double* x, double* y, int num_x) const;
+
+        /// @brief Evaluate the values at all x, as operator()(double).
+        /// @param x vector of domain values
+        /// @return vector of f(x[i])
+        std::vector<double> evaluate(const std::vector<double>& x) const;
+
+        /// @brief Evaluate the derivatives at all x, as derivative(double).
+        /// @param x array of domain values
+        /// @param dy output array of derivatives, f'(x[i])
+        /// @param num_x the number of values in x and dy.
+        void derivative(const double* x, double* dy, int num_x) const;
+
+        /// @brief Evaluate the derivatives at all x, as derivative(double).
+        /// @param x vector of domain values
+        /// @return vector of f'(x[i])
+        std::vector<double> derivative(const std::vector<double>& x) const;
+
         /// @brief Evaluate the inverse at y. Requires T to be a double.
         /// @param y a range value
         /// @return f^{-1}(y)
@@ -82,6 +106,8 @@ namespace Opm
         bool operator==(const NonuniformTableLinear& other) const;
 
     protected:
+        int intervalIndex(const double x) const;
+
         std::vector<double> x_values_;
         std::vector<T> y_values_;
         mutable std::vector<T> x_values_reversed_;
@@ -175,6 +201,74 @@ namespace Opm
         return Opm::linearInterpolationDerivative(x_values_, y_values_, x);
     }
 
+    template<typename T>
+    inline int
+    NonuniformTableLinear<T>
+    ::intervalIndex(const double x) const
+    {
+        // Same interval as tableIndex() for the nondecreasing x_values_:
+        // the last j in [0, n-2] with x_values_[j] <= x, or 0 if there is
+        // none. The number of iterations only depends on n, and the
+        // conditional move is compiled without a branch.
+        const double* base = x_values_.data();
+        int len = int(x_values_.size()) - 1;
+        while (len > 1) {
+            const int half = len / 2;
+            base = (base[half] <= x) ? base + half : base;
+            len -= half;
+        }
+        return int(base - x_values_.data());
+    }
+
+    template<typename T>
+    inline void
+    NonuniformTableLinear<T>
+    ::evaluate(const double* x, double* y, int num_x) const
+    {
+        // Extrapolates if x is outside x_values_, as linearInterpolation().
+        const double* xv = x_values_.data();
+        const T* yv = y_values_.data();
+        for (int i = 0; i < num_x; ++i) {
+            const int ix1 = intervalIndex(x[i]);
+            const int ix2 = ix1 + 1;
+            y[i] = (yv[ix2] - yv[ix1])/(xv[ix2] - xv[ix1])*(x[i] - xv[ix1]) + yv[ix1];
+        }
+    }
+
+    template<typename T>
+    inline std::vector<double>
+    NonuniformTableLinear<T>
+    ::evaluate(const std::vector<double>& x) const
+    {
+        std::vector<double> y(x.size());
+        evaluate(x.data(), y.data(), int(x.size()));
+        return y;
+    }
+
+    template<typename T>
+    inline void
+    NonuniformTableLinear<T>
+    ::derivative(const double* x, double* dy, int num_x) const
+    {
+        const double* xv = x_values_.data();
+        const T* yv = y_values_.data();
+        for (int i = 0; i < num_x; ++i) {
+            const int ix1 = intervalIndex(x[i]);
+            const int ix2 = ix1 + 1;
+            dy[i] = (yv[ix2] - yv[ix1])/(xv[ix2] - xv[ix1]);
+        }
+    }
+
+    template<typename T>
+    inline std::vector<double>
+    NonuniformTableLinear<T>
+    ::derivative(const std::vector<double>& x) const
+    {
+        std::vector<double> dy(x.size());
+        derivative(x.data(), dy.data(), int(x.size()));
+        return dy;
+    }
+
     template<typename T>
     inline double
     NonuniformTableLinear<T>
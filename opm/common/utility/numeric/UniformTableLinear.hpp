@@ -20,6 +20,8 @@
 #ifndef OPM_UNIFORMTABLELINEAR_HEADER_INCLUDED
 #define OPM_UNIFORMTABLELINEAR_HEADER_INCLUDED
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <exception>
 #include <vector>
@@ -76,6 +78,30 @@ namespace Opm {
 	    /// @return f'(x)
 	    double derivative(const double x) const;
 
+	    /// @brief Evaluate the values at all x, as operator()(double).
+	    ///        The loop has no branches and is vectorized by the
+	    ///        compiler where the target supports it.
+	    /// @param x array of domain values
+	    /// @param y output array of range values, f(x[i])
+	    /// @param num_x the number of values in x and y.
+	    void evaluate(const double* x, double* y, int num_x) const;
+
+	    /// @brief Evaluate the values at all x, as operator()(double).
+	    /// @param x vector of domain values
+	    /// @return vector of f(x[i])
+	    std::vector<double> evaluate(const std::vector<double>& x) const;
+
+	    /// @brief Evaluate the derivatives at all x, as derivative(double).
+	    /// @param x array of domain values
+	    /// @param dy output array of derivatives, f'(x[i])
+	    /// @param num_x the number of values in x and dy.
+	    void derivative(const double* x, double* dy, int num_x) const;
+
+	    /// @brief Evaluate the derivatives at all x, as derivative(double).
+	    /// @param x vector of domain values
+	    /// @return vector of f'(x[i])
+	    std::vector<double> derivative(const std::vector<double>& x) const;
+
 	    /// @brief Equality operator.
 	    /// @param other another UniformTableLinear.
 	    /// @return true if they are represented exactly alike.
@@ -210,6 +236,93 @@ namespace Opm {
 	}
 
 
+	template<typename T>
+	inline void
+	UniformTableLinear<T>
+	::evaluate(const double* x, double* y, int num_x) const
+	{
+            // Implements ClosestValue policy, as operator()(double). The
+            // interval index and weight are clamped to the last interval
+            // instead of special casing xmax_, giving y_values_.back().
+            //
+            // The results go through a local block: the compiler can not
+            // vectorize the gathers from y_values_ if the stores may alias
+            // them, and the members are copied to locals for the same reason.
+            const double xmin = xmin_;
+            const double xmax = xmax_;
+            const double xdelta = xdelta_;
+            const int last = int(y_values_.size()) - 2;
+            const T* yv = y_values_.data();
+            const int block_size = 64;
+            double block[block_size];
+            for (int start = 0; start < num_x; start += block_size) {
+                const double* xb = x + start;
+                const int len = std::min(block_size, num_x - start);
+                for (int i = 0; i < len; ++i) {
+                    const double xc = xb[i] < xmax ? xb[i] : xmax;
+                    const double xi = xc > xmin ? xc : xmin;
+                    const double pos = (xi - xmin)/xdelta;
+                    const int ipos = int(pos);
+                    const int left = ipos < last ? ipos : last;
+                    const double w = (pos - left) < 1.0 ? (pos - left) : 1.0;
+                    block[i] = (1.0 - w)*yv[left] + w*yv[left + 1];
+                }
+                std::copy(block, block + len, y + start);
+            }
+	}
+
+	template<typename T>
+	inline std::vector<double>
+	UniformTableLinear<T>
+	::evaluate(const std::vector<double>& x) const
+	{
+            std::vector<double> y(x.size());
+            evaluate(x.data(), y.data(), int(x.size()));
+            return y;
+	}
+
+	template<typename T>
+	inline void
+	UniformTableLinear<T>
+	::derivative(const double* x, double* dy, int num_x) const
+	{
+            // Derivative consistent with the ClosestValue policy, as
+            // derivative(double): zero outside the domain. Blocked as in
+            // evaluate().
+            const double xmin = xmin_;
+            const double xmax = xmax_;
+            const double xdelta = xdelta_;
+            const int last = int(y_values_.size()) - 2;
+            const T* yv = y_values_.data();
+            const int block_size = 64;
+            double block[block_size];
+            for (int start = 0; start < num_x; start += block_size) {
+                const double* xb = x + start;
+                const int len = std::min(block_size, num_x - start);
+                for (int i = 0; i < len; ++i) {
+                    const double xc = xb[i] < xmax ? xb[i] : xmax;
+                    const double xi = xc > xmin ? xc : xmin;
+                    const double pos = (xi - xmin)/xdelta;
+                    const int ipos = int(pos);
+                    const int left = ipos < last ? ipos : last;
+                    const double slope = (yv[left + 1] - yv[left])/xdelta;
+                    block[i] = (xb[i] > xmax || xb[i] < xmin) ? 0.0 : slope;
+                }
+                std::copy(block, block + len, dy + start);
+            }
+	}
+
+	template<typename T>
+	inline std::vector<double>
+	UniformTableLinear<T>
+	::derivative(const std::vector<double>& x) const
+	{
+            std::vector<double> dy(x.size());
+            derivative(x.data(), dy.data(), int(x.size()));
+            return dy;
+	}
+
+
 	template<typename T>
 	inline bool
 	UniformTableLinear<T>
@@ -54,6 +54,7 @@ class Solution : public std::map< std::string, data::CellData > {
 
         void convertToSI( const UnitSystem& );
         void convertFromSI( const UnitSystem& );
+        bool isSI() const;
 
     private:
         bool si = true;
@@ -0,0 +1,157 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_OUTPUT_ECL_OUTPUT_HPP
+#define OPM_OUTPUT_ECL_OUTPUT_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <opm/parser/eclipse/Units/UnitSystem.hpp>
+
+namespace Opm { namespace out {
+
+/*
+  The EclOutput class writes keywords to an unformatted eclipse file,
+  i.e. a sequence of big endian fortran records where every keyword is
+  a 16 byte header record with the name, the number of elements and the
+  element type, followed by the elements in records of at most 1000
+  numbers or 105 strings.
+
+  The records are encoded directly into one large buffer, which is
+  written to the file when it is full and on flush(). The elements are
+  byte swapped - and double values narrowed to float - a record at a
+  time, with SSE2 where it is available.
+*/
+
+class EclOutput {
+    public:
+        static const size_t default_buffer_size = 4 * 1024 * 1024;
+
+        explicit EclOutput( const std::string& filename,
+                            bool append = false,
+                            size_t buffer_size = default_buffer_size );
+
+        /*
+          The destructor writes the buffered records, but errors are
+          ignored; use close() to have them reported.
+        */
+        ~EclOutput();
+
+        EclOutput( const EclOutput& ) = delete;
+        EclOutput& operator=( const EclOutput& ) = delete;
+
+        void write( const std::string& name, const std::vector< int >& data );
+        void write( const std::string& name, const std::vector< float >& data );
+        void write( const std::string& name, const std::vector< double >& data );
+        void write( const std::string& name, const std::vector< std::string >& data );
+
+        /* Writes the double values as a REAL keyword. */
+        void writeFloat( const std::string& name, const std::vector< double >& data );
+
+        /*
+          Writes values in SI units converted to the output units - as a
+          REAL keyword, or DOUB if write_double is set - one record at a
+          time, i.e. the input vector is neither modified nor copied.
+        */
+        void writeFromSI( const std::string& name,
+                          const std::vector< double >& data,
+                          const UnitSystem& units,
+                          UnitSystem::measure dim,
+                          bool write_double );
+
+        /* Writes a keyword without data, like the STARTSOL and ENDSOL markers. */
+        void message( const std::string& name );
+
+        void flush();
+        void close();
+
+        const std::string& filename() const;
+
+    private:
+        template< typename Encode >
+        void writeArray( const std::string& name, const char* type, size_t count,
+                         size_t element_size, size_t block_size, Encode encode );
+        void writeHeader( const std::string& name, size_t count, const char* type );
+        char* reserve( size_t size );
+        void writeBuffer();
+
+        std::string m_filename;
+        std::ofstream stream;
+        std::vector< char > buffer;
+        size_t used = 0;
+        std::vector< double > scratch;
+};
+
+
+/*
+  The EclPositionedOutput class writes REAL and DOUB keywords of an
+  unformatted eclipse file in parts, with positioned writes at given
+  file offsets. The layout of such a keyword only depends on its number
+  of elements, so several processes can write the elements they own
+  into the same keyword concurrently, once the offset of the keyword is
+  known.
+
+  writeRange() writes the record markers in front of, and after, the
+  records whose first, respectively last, element is in the range. If
+  every element is written exactly once, by any number of writers, the
+  keyword is complete and no byte is written twice.
+*/
+
+class EclPositionedOutput {
+    public:
+        explicit EclPositionedOutput( const std::string& filename );
+        ~EclPositionedOutput();
+
+        EclPositionedOutput( const EclPositionedOutput& ) = delete;
+        EclPositionedOutput& operator=( const EclPositionedOutput& ) = delete;
+
+        /* The number of bytes of a REAL or DOUB keyword, the header included. */
+        static std::uint64_t keywordSize( size_t count, bool write_double );
+
+        /* Truncates or extends the file; extending leaves holes for the keyword data. */
+        void resize( std::uint64_t size );
+
+        void writeHeader( std::uint64_t offset, const std::string& name, size_t count, bool write_double );
+        void message( std::uint64_t offset, const std::string& name );
+
+        /*
+          Writes values to the elements first, ..., first + n - 1 of the
+          keyword with count elements whose header is at offset.
+        */
+        void writeRange( std::uint64_t offset,
+                         size_t count,
+                         size_t first,
+                         const double* values,
+                         size_t n,
+                         bool write_double );
+
+    private:
+        void pwrite( std::uint64_t offset, const char* data, size_t size );
+
+        std::string m_filename;
+        int fd;
+        std::vector< char > buffer;
+};
+
+}}
+
+#endif //OPM_OUTPUT_ECL_OUTPUT_HPP
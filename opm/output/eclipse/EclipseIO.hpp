@@ -155,6 +155,9 @@ public:
      * precision keywords, but this is non-standard, and other third
      * party applications might choke on those.
      *
+     * The RestartValue is not copied on the way to the restart file;
+     * pass it with std::move() to avoid the copy into the argument.
+     *
      * The misc_summary_values argument is used to pass pass various
      * summary values which are of type 'ECL_SMSPEC_MISC_VAR' to the
      * summary writer. The ability to pass miscellanous values to the
@@ -180,6 +183,31 @@ public:
                         bool write_double = false);
 
 
+    /*
+      Enables asynchronous output: writeTimeStep() will then only queue
+      the time step - moving the RestartValue into the queue - and the
+      summary evaluation and the summary, restart and RFT output are done
+      in order on a dedicated output thread.
+
+      At most max_queued_steps time steps are waiting in the queue;
+      when the queue is full writeTimeStep() blocks until the output
+      thread has completed a step. If the output of a step fails the
+      remaining queued steps are discarded, and the exception is
+      rethrown from the next call to writeTimeStep() or flush().
+    */
+    void enableAsyncOutput( size_t max_queued_steps = 2 );
+
+
+    /*
+      Waits until all queued time steps have been written, and rethrows
+      the exception of a failed step. This must be called before the
+      output files are read, e.g. at a checkpoint; it is also called
+      (without throwing) when the EclipseIO object is destroyed. In the
+      synchronous mode flush() does nothing.
+    */
+    void flush();
+
+
     /*
       Will load solution data and wellstate from the restart
       file. This method will consult the IOConfig object to get
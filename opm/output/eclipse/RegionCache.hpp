@@ -20,6 +20,7 @@
 #ifndef OPM_REGION_CACHE_HPP
 #define OPM_REGION_CACHE_HPP
 
+#include <cstddef>
 #include <vector>
 
 namespace Opm {
@@ -28,16 +29,56 @@ namespace Opm {
     class EclipseGrid;
 
 namespace out {
+    /*
+      The RegionCache holds the well connections of every FIPNUM region.
+
+      The connections of the wells change through the schedule, so the
+      cache holds one set of region connections for every report step
+      where the connections of some well change; connections( region,
+      timeStep ) returns the connections which are effective at the
+      given report step. Within a set the connections are stored
+      contiguously, grouped by region, and in the order of the wells in
+      Schedule::getWells() and of the connections of each well.
+    */
     class RegionCache {
     public:
+        struct Connection {
+            /* Position of the well in Schedule::getWells(). */
+            size_t well;
+            /* Position of the connection in the connections of the well at the report step. */
+            size_t connection;
+            size_t active_index;
+        };
+
+        class Range {
+        public:
+            Range( const Connection* first, const Connection* last );
+
+            const Connection* begin() const;
+            const Connection* end() const;
+            size_t size() const;
+            bool empty() const;
+            const Connection& operator[]( size_t index ) const;
+
+        private:
+            const Connection* first;
+            const Connection* last;
+        };
+
         RegionCache() = default;
         RegionCache(const Eclipse3DProperties& properties, const EclipseGrid& grid, const Schedule& schedule);
-        const std::vector<std::pair<std::string,size_t>>& connections( int region_id ) const;
+        Range connections( int region_id, size_t timeStep ) const;
 
     private:
-        std::vector<std::pair<std::string,size_t>> connections_empty;
+        struct Snapshot {
+            /* The connections of region r are [offsets[r], offsets[r + 1]). */
+            std::vector<size_t> offsets;
+            std::vector<Connection> connections;
+        };
 
-        std::map<int , std::vector<std::pair<std::string,size_t>>> connection_map;
+        /* first_step[i] is the first report step where snapshots[i] is effective. */
+        std::vector<size_t> first_step;
+        std::vector<Snapshot> snapshots;
     };
 }
 }
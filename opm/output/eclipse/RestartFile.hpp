@@ -0,0 +1,127 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_OUTPUT_RESTART_FILE_HPP
+#define OPM_OUTPUT_RESTART_FILE_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <opm/parser/eclipse/Units/UnitSystem.hpp>
+
+namespace Opm { namespace RestartIO {
+
+/*
+  The RestartFile class reads keywords from an unformatted restart
+  file - unified or not - without loading the file.
+
+  When the file is opened an index of the keywords is built. The index
+  holds the name, type, size and file offset of every keyword, grouped
+  by report step using the SEQNUM keywords of a unified file. Only the
+  keyword headers are read to build it. A file without SEQNUM keywords
+  holds a single report step, and that step is returned for any report
+  step argument, the same way RestartIO::load() treats non-unified
+  files.
+
+  With use_index_file set, the index is stored next to the restart file
+  in indexFilename( filename ). It is reused as long as the size and
+  modification time of the restart file are unchanged. If the index
+  file cannot be written the index is just rebuilt the next time.
+
+  A keyword is read by memory mapping only the file range of that
+  keyword. Large keywords are converted to double, and from output to
+  SI units, by several threads directly into the caller's vector.
+*/
+
+class RestartFile {
+    public:
+        struct Keyword {
+            std::string name;
+            std::string type;
+            size_t size;
+            std::uint64_t offset;
+        };
+
+        /*
+          num_threads == 0 uses all the cores of the machine; large
+          keywords are then read by up to that many threads.
+        */
+        explicit RestartFile( const std::string& filename,
+                              bool use_index_file = false,
+                              size_t num_threads = 0 );
+        ~RestartFile();
+
+        RestartFile( const RestartFile& ) = delete;
+        RestartFile& operator=( const RestartFile& ) = delete;
+
+        static std::string indexFilename( const std::string& filename );
+
+        const std::string& filename() const;
+
+        /* The report steps of the file, in file order; { -1 } if the file has no SEQNUM. */
+        std::vector< int > reportSteps() const;
+        bool hasReportStep( int report_step ) const;
+
+        bool hasKeyword( int report_step, const std::string& name ) const;
+
+        /*
+          The first keyword with the given name in the report step; throws
+          std::invalid_argument if the report step or keyword is not found.
+        */
+        const Keyword& keyword( int report_step, const std::string& name ) const;
+
+        std::vector< int > getInt( int report_step, const std::string& name ) const;
+
+        /* A REAL or DOUB keyword as double values. */
+        std::vector< double > getDouble( int report_step, const std::string& name ) const;
+
+        /*
+          Reads a REAL or DOUB keyword in output units into data, which
+          is resized to the keyword size, converting it to SI units with
+          the given dimension.
+        */
+        void readSI( int report_step,
+                     const std::string& name,
+                     const UnitSystem& units,
+                     UnitSystem::measure dim,
+                     std::vector< double >& data ) const;
+
+    private:
+        struct Step {
+            int report_step;
+            std::vector< Keyword > keywords;
+        };
+
+        const Step& step( int report_step ) const;
+        void buildIndex();
+        bool readIndexFile();
+        void writeIndexFile() const;
+
+        std::string m_filename;
+        int fd = -1;
+        std::uint64_t file_size = 0;
+        std::int64_t mtime_ns = 0;
+        size_t num_threads;
+        std::vector< Step > steps;
+};
+
+}}
+
+#endif //OPM_OUTPUT_RESTART_FILE_HPP
@@ -23,6 +23,7 @@
 #ifndef RESTART_IO_HPP
 #define RESTART_IO_HPP
 
+#include <cstdint>
 #include <vector>
 #include <map>
 
@@ -70,18 +71,67 @@ namespace RestartIO {
 
    will read and write to the file "CASE.X0010" - completely ignoring
    the report step argument '99'.
+
+   Unformatted files are loaded with RestartFile, which only reads the
+   keyword headers and the requested keywords of the report step. For
+   a unified file the keyword index is kept in a file next to it, see
+   RestartFile::indexFilename().
+
+   The RestartValue passed to save() is not modified; the conversion
+   from SI to output units is done while the keywords are filled, so
+   no copy of the restart data is made.
 */
 
 void save(const std::string& filename,
           int report_step,
           double seconds_elapsed,
-          RestartValue value,
+          const RestartValue& value,
           const EclipseState& es,
           const EclipseGrid& grid,
           const Schedule& schedule,
           bool write_double = false);
 
 
+/*
+  Restart output for a distributed simulation, where every process
+  holds the solution of the active cells it owns; instead of gathering
+  the solution on one process for save(), the processes write their
+  cells directly into the restart file:
+
+    1. One process calls saveLayout(). It writes the header, the wells
+       and the extra data, and the keyword headers of the solution
+       fields, and returns the file offset of the solution. Only the
+       names, dimensions and targets of value.solution are used.
+
+    2. The offset is passed to all the processes, which then call
+       saveSolutionSlice() - concurrently - with their part of the
+       solution and the global active indices of their cells. Every
+       active cell must be owned by exactly one process.
+
+  All the processes must pass solutions with the same fields, and the
+  same write_double; the file is written in the same layout as with
+  save(), so the result is identical. Only unformatted files are
+  supported.
+*/
+
+std::uint64_t saveLayout(const std::string& filename,
+                         int report_step,
+                         double seconds_elapsed,
+                         const RestartValue& value,
+                         const EclipseState& es,
+                         const EclipseGrid& grid,
+                         const Schedule& schedule,
+                         bool write_double = false);
+
+void saveSolutionSlice(const std::string& filename,
+                       std::uint64_t solution_offset,
+                       const data::Solution& solution,
+                       const std::vector<int>& global_index,
+                       const UnitSystem& units,
+                       size_t num_active,
+                       bool write_double = false);
+
+
 RestartValue load( const std::string& filename,
                    int report_step,
                    const std::vector<RestartKey>& solution_keys,
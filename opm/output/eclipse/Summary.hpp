@@ -20,6 +20,7 @@
 #ifndef OPM_OUTPUT_SUMMARY_HPP
 #define OPM_OUTPUT_SUMMARY_HPP
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -43,6 +44,8 @@ namespace Opm {
 
 namespace out {
 
+class SummaryWriter;
+
 class Summary {
     public:
         Summary( const EclipseState&, const SummaryConfig&, const EclipseGrid&, const Schedule& );
@@ -67,12 +70,19 @@ class Summary {
     private:
         class keyword_handlers;
 
+        void compile_plans( const Schedule& schedule, int sim_step );
+
         const EclipseGrid& grid;
         out::RegionCache regionCache;
         ERT::ert_unique_ptr< ecl_sum_type, ecl_sum_free > ecl_sum;
         std::unique_ptr< keyword_handlers > handlers;
+        std::unique_ptr< SummaryWriter > writer;
         double prev_time_elapsed = 0;
+
+        // The values of the last time step, and the buffer the next time
+        // step is evaluated into; they are swapped after every time step.
         SummaryState prev_state;
+        SummaryState state;
 };
 
 }
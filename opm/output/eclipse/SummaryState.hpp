@@ -20,8 +20,11 @@
 #ifndef SUMMARY_STATE_H
 #define SUMMARY_STATE_H
 
+#include <iterator>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace Opm{
 
@@ -31,10 +34,48 @@ namespace Opm{
   computed, ready to use summary values. The values will typically be used by
   the UDQ, WTEST and ACTIONX calculations. Observe that all value *have been
   converted to the correct output units*.
+
+  The values are stored in a dense vector, indexed by key ids. A key is
+  interned with add_key() - typically when the summary vectors are set
+  up - and the value can then be set and read with the id in constant
+  time, without any string handling. The string based add(), get() and
+  has() go through the key map; add() interns the key if it is new.
+
+  A value is defined from when it is set until reset() is called; the
+  keys and ids are kept by reset(). Iteration visits the defined values,
+  in id order.
 */
 class SummaryState {
 public:
-    typedef std::unordered_map<std::string, double>::const_iterator const_iterator;
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const std::string&, double>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        const_iterator(const SummaryState& state, size_t id);
+
+        value_type operator*() const;
+        const_iterator& operator++();
+        bool operator==(const const_iterator& other) const;
+        bool operator!=(const const_iterator& other) const;
+
+    private:
+        const SummaryState* state;
+        size_t id;
+    };
+
+    size_t add_key(const std::string& key);
+    size_t key_id(const std::string& key) const;
+    const std::string& key(size_t id) const;
+    size_t size() const;
+
+    void set(size_t id, double value);
+    double get(size_t id) const;
+    bool has(size_t id) const;
+    void reset();
 
     void add(const std::string& key, double value);
     double get(const std::string&) const;
@@ -43,7 +84,10 @@ public:
     const_iterator begin() const;
     const_iterator end() const;
 private:
-    std::unordered_map<std::string,double> values;
+    std::unordered_map<std::string, size_t> ids;
+    std::vector<std::string> keys;
+    std::vector<double> values;
+    std::vector<char> defined;
 };
 
 }
@@ -0,0 +1,118 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_OUTPUT_SUMMARY_WRITER_HPP
+#define OPM_OUTPUT_SUMMARY_WRITER_HPP
+
+#include <ctime>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace out {
+
+class EclOutput;
+
+/*
+  The SummaryWriter writes unformatted eclipse summary files, either as
+  one unified CASE.UNSMRY file or as one CASE.Snnnn file per report step,
+  together with the CASE.SMSPEC specification file.
+
+  Only the current ministep is kept in memory; the ministeps are written
+  with a buffered EclOutput, and the SMSPEC file is only rewritten when
+  the set of vectors has changed.
+
+  The first vector is always TIME, in days, which is set by
+  addTimestep(); the remaining vectors are added with addVector() and
+  set with set(). Vectors which are not set for a ministep are written
+  as zero.
+*/
+
+class SummaryWriter {
+    public:
+        SummaryWriter( const std::string& basename,
+                       bool unified,
+                       std::time_t start_time,
+                       int nx, int ny, int nz,
+                       int unit_type,
+                       const std::string& restart_case = "",
+                       int restart_step = -1 );
+
+        ~SummaryWriter();
+
+        SummaryWriter( const SummaryWriter& ) = delete;
+        SummaryWriter& operator=( const SummaryWriter& ) = delete;
+
+        /*
+          Registers a new vector and returns its position in the PARAMS
+          array; an empty wgname is written as the ':+:+:+:+' placeholder.
+        */
+        size_t addVector( const std::string& keyword,
+                          const std::string& wgname,
+                          int num,
+                          const std::string& unit );
+
+        size_t size() const;
+
+        void addTimestep( int report_step, double days );
+        void set( size_t index, float value );
+
+        void write();
+        void flush();
+
+        /*
+          The summary data file is flushed every flush_interval calls to
+          write(); the default is to flush on every call. With an interval
+          of zero the file is only flushed by flush(), when the output
+          buffer is full and on destruction.
+        */
+        void setFlushInterval( size_t flush_interval );
+
+    private:
+        void closeStep();
+        void writeSpecification();
+        void openDataFile( int report_step );
+
+        std::string basename;
+        bool unified;
+        std::time_t start_time;
+        int dims[3];
+        int unit_type;
+        std::string restart_case;
+        int restart_step;
+
+        std::vector< std::string > keywords;
+        std::vector< std::string > wgnames;
+        std::vector< int > nums;
+        std::vector< std::string > units;
+        bool specification_written = false;
+
+        std::vector< float > params;
+        int report_step = -1;
+        int ministep = -1;
+        bool step_open = false;
+
+        std::unique_ptr< EclOutput > data_file;
+        size_t flush_interval = 1;
+        size_t writes_since_flush = 0;
+};
+
+}}
+
+#endif //OPM_OUTPUT_SUMMARY_WRITER_HPP
@@ -33,6 +33,10 @@ namespace Opm {
     class UnitSystem;
     class EclipseState;
 
+    namespace out {
+        class EclOutput;
+    }
+
     class Tables {
     public:
         explicit Tables( const UnitSystem& units);
@@ -115,6 +119,14 @@ namespace Opm {
     ///    corresponds to a preopened stream attached to the INIT file.
     void fwrite(const Tables& tables,
                 ERT::FortIO&  fortio);
+
+    /// Emit the TABDIMS and TAB vectors with the native writer.
+    ///
+    /// \param[in] tables Collection of normalised tables.
+    ///
+    /// \param[in,out] output Unformatted ECL-like result set file.
+    void fwrite(const Tables&    tables,
+                out::EclOutput& output);
 }
 
 
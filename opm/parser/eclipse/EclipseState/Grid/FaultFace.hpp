@@ -20,24 +20,66 @@
 #define OPM_PARSER_FAULT_FACE_HPP
 
 #include <cstddef>
-#include <vector>
+#include <iterator>
 
 #include <opm/parser/eclipse/EclipseState/Grid/FaceDir.hpp>
 
 namespace Opm {
 
 
+/*
+  A FaultFace is a box I1..I2 x J1..J2 x K1..K2 of cell faces in one
+  direction. The box is stored as is, the global indices of the cells
+  are computed on the fly when iterating over the face.
+*/
 class FaultFace {
 public:
+    class const_iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef size_t value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const size_t* pointer;
+        typedef size_t reference;
+
+        const_iterator(const FaultFace& face, size_t i, size_t j, size_t k);
+        size_t operator*() const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        bool operator==(const const_iterator& other) const;
+        bool operator!=(const const_iterator& other) const;
+
+    private:
+        const FaultFace* m_face;
+        size_t m_i, m_j, m_k;
+    };
+
     FaultFace(size_t nx , size_t ny , size_t nz,
               size_t I1 , size_t I2,
               size_t J1 , size_t J2,
               size_t K1 , size_t K2,
               FaceDir::DirEnum faceDir);
 
-    std::vector<size_t>::const_iterator begin() const;
-    std::vector<size_t>::const_iterator end() const;
+    const_iterator begin() const;
+    const_iterator end() const;
     FaceDir::DirEnum getDir() const;
+    size_t size() const;
+
+    size_t getI1() const;
+    size_t getI2() const;
+    size_t getJ1() const;
+    size_t getJ2() const;
+    size_t getK1() const;
+    size_t getK2() const;
+
+    /*
+      Will multiply the values for all the cells in the face with
+      factor; data is a full nx*ny*nz grid property. The multiplication
+      is done one row of I values at a time, and only for the layers
+      [k1, k2) which also overlap the face.
+    */
+    template <typename T>
+    void multiply(T* data, T factor, size_t k1, size_t k2) const;
 
     bool operator==( const FaultFace& rhs ) const;
     bool operator!=( const FaultFace& rhs ) const;
@@ -45,10 +87,27 @@ public:
 private:
     static void checkCoord(size_t dim , size_t l1 , size_t l2);
     FaceDir::DirEnum m_faceDir;
-    std::vector<size_t> m_indexList;
+    size_t m_nx, m_ny;
+    size_t m_I1, m_I2;
+    size_t m_J1, m_J2;
+    size_t m_K1, m_K2;
 };
 
 
+template <typename T>
+void FaultFace::multiply(T* data, T factor, size_t k1, size_t k2) const {
+    const size_t kStart = (k1 > m_K1) ? k1 : m_K1;
+    const size_t kEnd = (k2 < m_K2 + 1) ? k2 : m_K2 + 1;
+
+    for (size_t k = kStart; k < kEnd; k++) {
+        for (size_t j = m_J1; j <= m_J2; j++) {
+            T* row = data + j*m_nx + k*m_nx*m_ny;
+            for (size_t i = m_I1; i <= m_I2; i++)
+                row[i] *= factor;
+        }
+    }
+}
+
 }
 
 #endif // OPM_PARSER_FAULT_FACE_HPP
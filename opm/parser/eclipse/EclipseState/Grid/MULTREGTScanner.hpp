@@ -21,6 +21,10 @@
 #ifndef OPM_PARSER_MULTREGTSCANNER_HPP
 #define OPM_PARSER_MULTREGTSCANNER_HPP
 
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
 #include <opm/parser/eclipse/EclipseState/Eclipse3DProperties.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/FaceDir.hpp>
 #include <opm/parser/eclipse/EclipseState/Util/Value.hpp>
@@ -75,11 +79,35 @@ namespace Opm {
         double getRegionMultiplier(size_t globalCellIdx1, size_t globalCellIdx2, FaceDir::DirEnum faceDir) const;
 
     private:
+        /*
+          Precompiled lookup structure for all the MULTREGT records
+          based on one region array. The region values are copied out
+          of the GridProperty when the scanner is constructed, and the
+          (region1, region2) -> record lookup is a dense matrix when the
+          span of region values is small, and a hash table otherwise.
+        */
+        class RegionLookup {
+        public:
+            RegionLookup(const std::vector<int>& regions, const MULTREGTSearchMap& searchMap, const std::vector< MULTREGTRecord >& records);
+            int region(size_t globalIndex) const;
+            int find(int regionId1, int regionId2) const;
+
+        private:
+            static std::uint64_t key(int regionId1, int regionId2);
+
+            std::vector<int> m_regions;
+            int m_minRegion;
+            int m_numRegions;
+            std::vector<int> m_dense;
+            std::unordered_map<std::uint64_t, int> m_sparse;
+        };
+
         void addKeyword( const DeckKeyword& deckKeyword, const std::string& defaultRegion);
         void assertKeywordSupported(const DeckKeyword& deckKeyword, const std::string& defaultRegion);
         std::vector< MULTREGTRecord > m_records;
-        std::map<std::string , MULTREGTSearchMap> m_searchMap;
-        const Eclipse3DProperties& m_e3DProps;
+        std::vector< RegionLookup > m_lookup;
+        size_t m_nx = 0;
+        size_t m_ny = 0;
     };
 
 }
@@ -33,6 +33,7 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include <opm/parser/eclipse/EclipseState/Grid/FaceDir.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/MULTREGTScanner.hpp>
@@ -51,6 +52,16 @@ namespace Opm {
         double getMultiplier(size_t globalIndex, FaceDir::DirEnum faceDir) const;
         double getMultiplier(size_t i , size_t j , size_t k, FaceDir::DirEnum faceDir) const;
         double getRegionMultiplier( size_t globalCellIndex1, size_t globalCellIndex2, FaceDir::DirEnum faceDir) const;
+
+        /*
+          Combined multipliers for all the faces in the faceDir
+          direction, which must be one of XPlus, YPlus or ZPlus. Element
+          g of the returned vector is the product of the MULTX (MULTY,
+          MULTZ) value of cell g, the MULTX- (MULTY-, MULTZ-) value of
+          the neighbouring cell and the MULTREGT multiplier between the
+          two cells; faces on the upper boundary of the grid get 1.0.
+        */
+        std::vector<double> getFaceMultipliers(FaceDir::DirEnum faceDir) const;
         void applyMULT(const GridProperty<double>& srcMultProp, FaceDir::DirEnum faceDir);
         void applyMULTFLT(const FaultCollection& faults);
         void applyMULTFLT(const Fault& fault);
@@ -22,6 +22,7 @@
 #define DYNAMICSTATE_HPP_
 
 #include <stdexcept>
+#include <utility>
 #include <vector>
 #include <algorithm>
 
@@ -49,6 +50,12 @@ namespace Opm {
        The update() method returns true if the updated value is
        different from the current value, this implies that the
        class<T> must support operator!=
+
+       Internally only the report steps where the value changes are
+       stored, together with the value which applies from that step
+       on; i.e. a value is stored once however many report steps it
+       applies to. Looking up the value at a report step is a binary
+       search among the change points.
     */
 
 
@@ -60,20 +67,26 @@ class DynamicState {
         typedef typename std::vector< T >::iterator iterator;
 
         DynamicState( const TimeMap& timeMap, T initial ) :
-            m_data( timeMap.size(), initial ),
+            m_steps( 1, 0 ),
+            m_values( 1, std::move( initial ) ),
+            m_size( timeMap.size() ),
             initial_range( timeMap.size() )
         {}
 
         void globalReset( T value ) {
-            this->m_data.assign( this->m_data.size(), value );
+            this->m_steps.assign( 1, 0 );
+            this->m_values.assign( 1, std::move( value ) );
         }
 
         const T& back() const {
-            return m_data.back();
+            return m_values.back();
         }
 
         const T& at( size_t index ) const {
-            return this->m_data.at( index );
+            if (index >= this->m_size)
+                throw std::out_of_range("Invalid index for DynamicState::at()");
+
+            return this->m_values[ this->changeIndex( index ) ];
         }
 
         const T& operator[](size_t index) const {
@@ -85,7 +98,7 @@ class DynamicState {
         }
 
         void updateInitial( T initial ) {
-            std::fill_n( this->m_data.begin(), this->initial_range, initial );
+            this->assign( 0, this->initial_range, std::move( initial ) );
         }
 
         /**
@@ -93,49 +106,101 @@ class DynamicState {
            return true, otherwise it will return false.
         */
         bool update( size_t index, T value ) {
-            if( this->initial_range == this->m_data.size() )
+            if( this->initial_range == this->m_size )
                 this->initial_range = index;
 
-            const bool change = (value != this->m_data.at( index ));
+            const bool change = (value != this->at( index ));
 
             if( !change ) return false;
 
-            std::fill( this->m_data.begin() + index,
-                       this->m_data.end(),
-                       value );
+            this->assign( index, this->m_size, std::move( value ) );
 
             return true;
         }
 
         void update_elm( size_t index, const T& value ) {
-            if (this->m_data.size() <= index)
+            if (this->m_size <= index)
                 throw std::out_of_range("Invalid index for update_elm()");
 
-            this->m_data[index] = value;
+            this->assign( index, index + 1, value );
         }
 
         /// Will return the index of the first occurence of @value, or
         /// -1 if @value is not found.
         int find(const T& value) const {
-            auto iter = std::find( m_data.begin() , m_data.end() , value);
-            if( iter == this->m_data.end() ) return -1;
+            auto iter = std::find( m_values.begin() , m_values.end() , value);
+            if( iter == this->m_values.end() ) return -1;
 
-            return std::distance( m_data.begin() , iter );
+            return this->m_steps[ std::distance( m_values.begin() , iter ) ];
         }
 
 
-
+        /*
+          Iteration is over the distinct values, i.e. one element for
+          each change point and not one for each report step.
+        */
         iterator begin() {
-            return this->m_data.begin();
+            return this->m_values.begin();
         }
 
 
         iterator end() {
-            return this->m_data.end();
+            return this->m_values.end();
         }
 
     private:
-        std::vector< T > m_data;
+        /*
+          Index into m_steps/m_values of the change point which applies
+          at report step @index.
+        */
+        size_t changeIndex( size_t index ) const {
+            const auto iter = std::upper_bound( this->m_steps.begin(), this->m_steps.end(), index );
+            return std::distance( this->m_steps.begin(), iter ) - 1;
+        }
+
+        /*
+          Sets the value for the report steps [first, last), the values
+          at the report steps from last on are unchanged.
+        */
+        void assign( size_t first, size_t last, T value ) {
+            if (first >= last)
+                return;
+
+            const size_t first_change = this->changeIndex( first );
+            size_t last_change = first_change;
+            if (last < this->m_size) {
+                last_change = this->changeIndex( last );
+                if (this->m_steps[ last_change ] != last) {
+                    /*
+                      The value at report step last must be kept; make
+                      it a change point of its own.
+                    */
+                    this->m_steps.insert( this->m_steps.begin() + last_change + 1, last );
+                    this->m_values.insert( this->m_values.begin() + last_change + 1, this->m_values[ last_change ] );
+                    last_change += 1;
+                }
+            } else
+                last_change = this->m_steps.size();
+
+            /*
+              The change points in [first_change, last_change) are
+              replaced with the single change point (first, value); the
+              change point at first_change is reused when it starts at
+              first, otherwise it is kept and the new one follows it.
+            */
+            size_t pos = first_change;
+            if (this->m_steps[ pos ] != first)
+                pos += 1;
+
+            this->m_steps.erase( this->m_steps.begin() + pos, this->m_steps.begin() + last_change );
+            this->m_values.erase( this->m_values.begin() + pos, this->m_values.begin() + last_change );
+            this->m_steps.insert( this->m_steps.begin() + pos, first );
+            this->m_values.insert( this->m_values.begin() + pos, std::move( value ) );
+        }
+
+        std::vector< size_t > m_steps;
+        std::vector< T > m_values;
+        size_t m_size;
         size_t initial_range;
 };
 
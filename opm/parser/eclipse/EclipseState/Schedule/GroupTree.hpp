@@ -21,41 +21,56 @@
 #define GROUPTREE_HPP
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Opm {
 
+/*
+  The GroupTree gives every group an integer id when it is first added
+  to the tree; FIELD has id 0. The tree itself is stored as parent,
+  first child and next sibling arrays indexed by id, with the children
+  of a group linked in name order. Ids are never reused, so a tree which
+  is copied and then updated - as the Schedule does for every report
+  step where GRUPTREE or WELSPECS changes the tree - keeps the ids of
+  the groups it already had.
+
+  The string based methods are thin adapters on top of the id based
+  ones. A missing parent, child or sibling is returned as -1.
+*/
+
 class GroupTree {
     public:
+        GroupTree();
+
         void update( const std::string& name );
         void update( const std::string& name, const std::string& parent );
         bool exists( const std::string& group ) const;
         const std::string& parent( const std::string& name ) const;
         std::vector< std::string > children( const std::string& parent ) const;
 
+        size_t size() const;
+        int groupId( const std::string& name ) const;
+        const std::string& groupName( int id ) const;
+        int parentId( int id ) const;
+        int firstChild( int id ) const;
+        int nextSibling( int id ) const;
+
         bool operator==( const GroupTree& ) const;
         bool operator!=( const GroupTree& ) const;
 
     private:
-        struct group {
-            std::string name;
-            std::string parent;
-
-            bool operator<( const group& rhs ) const;
-            bool operator==( const std::string& name ) const;
-            bool operator!=( const std::string& name ) const;
-
-            bool operator<( const std::string& name ) const;
-            bool operator==( const group& rhs ) const;
-            bool operator!=( const group& rhs ) const;
-        };
-
-        std::vector< group > groups = { group { "FIELD", "" } };
-        friend bool operator<( const std::string&, const group& );
-        std::vector< group >::iterator find( const std::string& );
+        std::vector< std::string > names;
+        std::unordered_map< std::string, int > ids;
+        std::vector< int > parents;
+        std::vector< int > first_child;
+        std::vector< int > next_sibling;
+
+        int insert( const std::string& name, int parent );
+        void link( int id, int parent );
+        void unlink( int id );
 };
 
 }
 
 #endif /* GROUPTREE_HPP */
-
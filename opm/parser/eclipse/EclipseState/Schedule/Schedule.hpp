@@ -33,6 +33,7 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/ScheduleEnums.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Tuning.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Well.hpp>
+#include <opm/parser/eclipse/EclipseState/Util/NameIndex.hpp>
 #include <opm/parser/eclipse/EclipseState/Util/OrderedMap.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/MessageLimits.hpp>
 #include <opm/parser/eclipse/EclipseState/Runspec.hpp>
@@ -66,6 +67,11 @@ namespace Opm
                  const EclipseState& es,
                  const ParseContext& parseContext = ParseContext());
 
+        Schedule(const Schedule& other);
+        Schedule(Schedule&& other) = default;
+        Schedule& operator=(const Schedule& other);
+        Schedule& operator=(Schedule&& other) = default;
+
         /*
          * If the input deck does not specify a start time, Eclipse's 1. Jan
          * 1983 is defaulted
@@ -82,20 +88,18 @@ namespace Opm
         size_t getMaxNumConnectionsForWells(size_t timestep) const;
         bool hasWell(const std::string& wellName) const;
         const Well* getWell(const std::string& wellName) const;
-        std::vector< const Well* > getOpenWells(size_t timeStep) const;
-        std::vector< const Well* > getWells() const;
-        std::vector< const Well* > getWells(size_t timeStep) const;
+        const std::vector< const Well* >& getOpenWells(size_t timeStep) const;
+        const std::vector< const Well* >& getWells() const;
+        const std::vector< const Well* >& getWells(size_t timeStep) const;
 
         /*
           The overload with a group name argument will return all
-          wells beneath that particular group; i.e.
-
-             getWells("FIELD",t);
-
-          is an inefficient way to get all the wells defined at time
-          't'.
+          wells beneath that particular group. The well lists are
+          assembled when the Schedule is constructed, so these calls
+          return a reference to a stored list without any searching
+          or allocation.
         */
-        std::vector< const Well* > getWells(const std::string& group, size_t timeStep) const;
+        const std::vector< const Well* >& getWells(const std::string& group, size_t timeStep) const;
         std::vector< const Well* > getWellsMatching( const std::string& ) const;
         const OilVaporizationProperties& getOilVaporizationProperties(size_t timestep) const;
 
@@ -127,6 +131,8 @@ namespace Opm
         TimeMap m_timeMap;
         OrderedMap< Well > m_wells;
         OrderedMap< Group > m_groups;
+        NameIndex m_well_names;
+        NameIndex m_group_names;
         DynamicState< GroupTree > m_rootGroupTree;
         DynamicState< OilVaporizationProperties > m_oilvaporizationproperties;
         Events m_events;
@@ -138,10 +144,16 @@ namespace Opm
         std::map<int, DynamicState<std::shared_ptr<VFPInjTable>>> vfpinj_tables;
         DynamicState<std::shared_ptr<WellTestConfig>> wtest_config;
 
+        DynamicState< std::vector< const Well* > > m_defined_wells;
+        DynamicState< std::vector< const Well* > > m_open_wells;
+        std::map< std::string, DynamicState< std::vector< const Well* > > > m_group_wells;
+
         WellProducer::ControlModeEnum m_controlModeWHISTCTL;
 
         std::vector< Well* > getWells(const std::string& wellNamePattern);
         std::vector< Group* > getGroups(const std::string& groupNamePattern);
+        std::vector< const Well* > groupWells(const std::string& group_name, size_t timeStep) const;
+        void updateWellViews();
 
         void updateWellStatus( Well& well, size_t reportStep , WellCommon::StatusEnum status);
         void addWellToGroup( Group& newGroup , Well& well , size_t timeStep);
@@ -185,8 +197,8 @@ namespace Opm
         void handleWECON( const DeckKeyword& keyword, size_t currentStep, const ParseContext& parseContext);
         void handleWHISTCTL(const ParseContext& parseContext, const DeckKeyword& keyword);
         void handleMESSAGES(const DeckKeyword& keyword, size_t currentStep);
-        void handleVFPPROD(const DeckKeyword& vfpprodKeyword, const UnitSystem& unit_system, size_t currentStep);
-        void handleVFPINJ(const DeckKeyword& vfpprodKeyword, const UnitSystem& unit_system, size_t currentStep);
+        void handleVFPPROD(std::shared_ptr<VFPProdTable> table, size_t currentStep);
+        void handleVFPINJ(std::shared_ptr<VFPInjTable> table, size_t currentStep);
         void checkUnhandledKeywords( const SCHEDULESection& ) const;
         void checkIfAllConnectionsIsShut(size_t currentStep);
 
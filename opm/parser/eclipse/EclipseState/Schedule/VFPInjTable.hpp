@@ -21,7 +21,10 @@
 #ifndef OPM_PARSER_ECLIPSE_ECLIPSESTATE_TABLES_VFPINJTABLE_HPP_
 #define OPM_PARSER_ECLIPSE_ECLIPSESTATE_TABLES_VFPINJTABLE_HPP_
 
+#include <vector>
+
 #include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/VFPInterpolation.hpp>
 
 
 #include <boost/multi_array.hpp>
@@ -91,6 +94,25 @@ public:
         return m_data;
     }
 
+    /**
+     * Bottom hole pressure, with the THP and FLO derivatives, from
+     * bilinear interpolation in the table. Arguments outside the axis
+     * ranges are extrapolated linearly.
+     */
+    VFPEvaluation bhp(double flo, double thp) const;
+
+    /**
+     * Batch version of bhp() for a set of wells.
+     */
+    std::vector<VFPEvaluation> bhp(const std::vector<double>& flo,
+                                   const std::vector<double>& thp) const;
+
+    /**
+     * Tubing head pressure giving the bottom hole pressure @bhp, i.e.
+     * bhp() inverted with respect to THP.
+     */
+    double thp(double flo, double bhp) const;
+
 private:
 
     int m_table_num;
@@ -102,7 +124,13 @@ private:
 
 
     array_type m_data;
+
+    VFPAxis m_flo_axis;
+    VFPAxis m_thp_axis;
+
     void check();
+    void initAxes();
+    VFPEvaluation interpolate(const VFPAxisPoint& flo, const VFPAxisPoint& thp) const;
 
     static FLO_TYPE getFloType(std::string flo_string);
 
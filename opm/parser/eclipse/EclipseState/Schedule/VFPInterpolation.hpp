@@ -0,0 +1,163 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PARSER_ECLIPSE_ECLIPSESTATE_TABLES_VFPINTERPOLATION_HPP_
+#define OPM_PARSER_ECLIPSE_ECLIPSESTATE_TABLES_VFPINTERPOLATION_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <opm/common/utility/numeric/RootFinders.hpp>
+
+namespace Opm {
+
+/**
+ * Bottom hole pressure evaluated from a VFP table, together with the
+ * partial derivatives with respect to the table arguments. For
+ * injection tables only the THP and FLO derivatives are nonzero.
+ */
+struct VFPEvaluation {
+    double value = 0.0;
+    double dthp = 0.0;
+    double dwfr = 0.0;
+    double dgfr = 0.0;
+    double dalq = 0.0;
+    double dflo = 0.0;
+};
+
+
+/**
+ * Interpolation point on one VFP table axis: the argument is located
+ * between the axis values with index 'index' and 'next', at relative
+ * position 'factor'. Arguments outside the axis range are extrapolated
+ * linearly from the first or last interval, i.e. 'factor' is then
+ * outside [0,1]. For an axis with a single value index == next and
+ * both 'factor' and 'inv_width' are zero.
+ */
+struct VFPAxisPoint {
+    std::size_t index;
+    std::size_t next;
+    double factor;
+    double inv_width;
+};
+
+
+/**
+ * A VFP table axis with the inverse interval widths precomputed, so
+ * that locating an argument costs one bisection and no division.
+ */
+class VFPAxis {
+public:
+    VFPAxis() = default;
+
+    explicit VFPAxis(const std::vector<double>& values) :
+        m_values(values)
+    {
+        for (std::size_t i = 0; i + 1 < m_values.size(); ++i)
+            m_inv_width.push_back(1.0 / (m_values[i + 1] - m_values[i]));
+    }
+
+    VFPAxisPoint find(double arg) const {
+        if (m_values.size() < 2)
+            return { 0, 0, 0.0, 0.0 };
+
+        const auto upper = std::upper_bound(m_values.begin() + 1, m_values.end() - 1, arg);
+        const std::size_t index = (upper - m_values.begin()) - 1;
+        const double inv_width = m_inv_width[index];
+
+        return { index, index + 1, (arg - m_values[index]) * inv_width, inv_width };
+    }
+
+    std::size_t size() const {
+        return m_values.size();
+    }
+
+private:
+    std::vector<double> m_values;
+    std::vector<double> m_inv_width;
+};
+
+
+/**
+ * Combines the evaluations at the lower and upper end of an axis
+ * interval; the derivative along the axis itself is given by the
+ * difference quotient and stored in the member 'axis_derivative'.
+ */
+inline VFPEvaluation VFPInterpolate(const VFPEvaluation& lower,
+                                    const VFPEvaluation& upper,
+                                    const VFPAxisPoint& point,
+                                    double VFPEvaluation::* axis_derivative) {
+    const double w1 = 1.0 - point.factor;
+    const double w2 = point.factor;
+
+    VFPEvaluation result;
+    result.value = w1 * lower.value + w2 * upper.value;
+    result.dthp  = w1 * lower.dthp  + w2 * upper.dthp;
+    result.dwfr  = w1 * lower.dwfr  + w2 * upper.dwfr;
+    result.dgfr  = w1 * lower.dgfr  + w2 * upper.dgfr;
+    result.dalq  = w1 * lower.dalq  + w2 * upper.dalq;
+    result.dflo  = w1 * lower.dflo  + w2 * upper.dflo;
+    result.*axis_derivative = (upper.value - lower.value) * point.inv_width;
+
+    return result;
+}
+
+
+/**
+ * Solves bhp_function(thp).value == bhp for thp. Within the range of
+ * the THP axis the root is found with RegulaFalsi; outside of it the
+ * interpolated BHP is linear in THP and the root is found directly.
+ */
+template <class BhpFunction>
+double VFPFindTHP(const BhpFunction& bhp_function,
+                  const std::vector<double>& thp_axis,
+                  double bhp) {
+    if (thp_axis.size() < 2)
+        throw std::invalid_argument("Can not find THP from a VFP table with a single THP value");
+
+    const double thp_min = thp_axis.front();
+    const double thp_max = thp_axis.back();
+    const VFPEvaluation eval_min = bhp_function(thp_min);
+    const VFPEvaluation eval_max = bhp_function(thp_max);
+    const double residual_min = eval_min.value - bhp;
+    const double residual_max = eval_max.value - bhp;
+
+    if (residual_min * residual_max <= 0.0) {
+        const auto residual = [&bhp_function, bhp](double thp) { return bhp_function(thp).value - bhp; };
+        const double tolerance = 1.0e-10 * std::max(std::fabs(bhp), 1.0);
+        const int max_iter = 100;
+        int iterations_used = 0;
+
+        return RegulaFalsi<ThrowOnError>::solve(residual, thp_min, thp_max, max_iter, tolerance, iterations_used);
+    }
+
+    const bool below = std::fabs(residual_min) <= std::fabs(residual_max);
+    const VFPEvaluation& eval = below ? eval_min : eval_max;
+    if (eval.dthp == 0.0)
+        throw std::invalid_argument("Can not find THP, the VFP table does not depend on THP");
+
+    return (below ? thp_min : thp_max) - (below ? residual_min : residual_max) / eval.dthp;
+}
+
+}
+
+#endif
@@ -21,8 +21,12 @@
 #define OPM_PARSER_ECLIPSE_ECLIPSESTATE_TABLES_VFPPRODTABLE_HPP_
 
 
+#include <vector>
+
 #include <boost/multi_array.hpp>
 
+#include <opm/parser/eclipse/EclipseState/Schedule/VFPInterpolation.hpp>
+
 namespace Opm {
 
     class DeckItem;
@@ -148,6 +152,29 @@ public:
         return m_data;
     }
 
+    /**
+     * Bottom hole pressure, with partial derivatives, from multilinear
+     * interpolation in the table. Arguments outside the axis ranges are
+     * extrapolated linearly.
+     */
+    VFPEvaluation bhp(double flo, double thp, double wfr, double gfr, double alq) const;
+
+    /**
+     * Batch version of bhp() for a set of wells; all argument vectors
+     * must have the same size.
+     */
+    std::vector<VFPEvaluation> bhp(const std::vector<double>& flo,
+                                   const std::vector<double>& thp,
+                                   const std::vector<double>& wfr,
+                                   const std::vector<double>& gfr,
+                                   const std::vector<double>& alq) const;
+
+    /**
+     * Tubing head pressure giving the bottom hole pressure @bhp, i.e.
+     * bhp() inverted with respect to THP.
+     */
+    double thp(double flo, double wfr, double gfr, double alq, double bhp) const;
+
 
 private:
 
@@ -166,7 +193,19 @@ private:
 
     array_type m_data;
 
+    VFPAxis m_flo_axis;
+    VFPAxis m_thp_axis;
+    VFPAxis m_wfr_axis;
+    VFPAxis m_gfr_axis;
+    VFPAxis m_alq_axis;
+
     void check(const DeckKeyword& table, const double factor);
+    void initAxes();
+    VFPEvaluation interpolate(const VFPAxisPoint& flo,
+                              const VFPAxisPoint& thp,
+                              const VFPAxisPoint& wfr,
+                              const VFPAxisPoint& gfr,
+                              const VFPAxisPoint& alq) const;
 
     static void scaleValues(std::vector<double>& values,
                             const double& scaling_factor);
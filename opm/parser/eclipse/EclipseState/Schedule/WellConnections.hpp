@@ -85,7 +85,6 @@ namespace Opm {
                            const WellCompletion::DirectionEnum direction = WellCompletion::DirectionEnum::Z);
 
         std::vector< Connection > m_connections;
-        size_t findClosestConnection(int oi, int oj, double oz, size_t start_pos);
         int headI, headJ;
     };
 }
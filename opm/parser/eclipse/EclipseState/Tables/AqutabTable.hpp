@@ -27,6 +27,8 @@ namespace Opm {
 
     class AqutabTable : public SimpleTable {
     public:
+        enum class Column : size_t { TD, PD };
+
         AqutabTable( const DeckItem& item );
 
         const TableColumn& getTimeColumn() const;
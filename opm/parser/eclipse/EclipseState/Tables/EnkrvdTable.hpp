@@ -27,6 +27,8 @@ namespace Opm {
 
     class EnkrvdTable : public SimpleTable {
     public:
+        enum class Column : size_t { DEPTH, KRWMAX, KRGMAX, KROMAX, KRWCRIT, KRGCRIT, KROCRITG, KROCRITW };
+
 
         EnkrvdTable( const DeckItem& item );
 
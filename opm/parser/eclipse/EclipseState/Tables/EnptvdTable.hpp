@@ -27,6 +27,8 @@ namespace Opm {
 
     class EnptvdTable : public SimpleTable {
     public:
+        enum class Column : size_t { DEPTH, SWCO, SWCRIT, SWMAX, SGCO, SGCRIT, SGMAX, SOWCRIT, SOGCRIT };
+
         EnptvdTable( const DeckItem& item );
         
         // using this method is strongly discouraged but the current endpoint scaling
@@ -29,6 +29,8 @@ namespace Opm {
 
     class GasvisctTable : public SimpleTable {
     public:
+        enum class Column : size_t { Temperature };
+
         GasvisctTable( const Deck& deck, const DeckItem& deckItem );
 
         const TableColumn& getTemperatureColumn() const;
@@ -27,6 +27,8 @@ namespace Opm {
 
     class ImkrvdTable : public SimpleTable {
     public:
+        enum class Column : size_t { DEPTH, KRWMAX, KRGMAX, KROMAX, KRWCRIT, KRGCRIT, KROCRITG, KROCRITW };
+
         ImkrvdTable( const DeckItem& item );
 
         /*!
@@ -28,6 +28,8 @@ namespace Opm {
 
     class ImptvdTable : public SimpleTable {
     public:
+        enum class Column : size_t { DEPTH, SWCO, SWCRIT, SWMAX, SGCO, SGCRIT, SGMAX, SOWCRIT, SOGCRIT };
+
 
         ImptvdTable( const DeckItem& item );
 
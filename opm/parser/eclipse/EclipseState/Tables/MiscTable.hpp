@@ -28,6 +28,8 @@ namespace Opm {
 
     class MiscTable : public SimpleTable {
     public:
+        enum class Column : size_t { SolventFraction, Miscibility };
+
         explicit MiscTable( const DeckItem& item );
 
         const TableColumn& getSolventFractionColumn() const;
@@ -28,6 +28,8 @@ namespace Opm {
 
     class MsfnTable : public SimpleTable {
     public:
+        enum class Column : size_t { GasPhaseFraction, GasSolventRelpermMultiplier, OilRelpermMultiplier };
+
         explicit MsfnTable( const DeckItem& item );
 
         const TableColumn& getGasPhaseFractionColumn() const;
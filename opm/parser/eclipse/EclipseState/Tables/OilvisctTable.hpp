@@ -27,6 +27,8 @@ namespace Opm {
 
     class OilvisctTable : public SimpleTable {
         public:
+            enum class Column : size_t { Temperature, Viscosity };
+
             OilvisctTable( const DeckItem& item );
 
             const TableColumn& getTemperatureColumn() const;
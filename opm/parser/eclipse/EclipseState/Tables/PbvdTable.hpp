@@ -27,6 +27,8 @@ namespace Opm {
 
     class PbvdTable : public SimpleTable {
     public:
+        enum class Column : size_t { DEPTH, PBUB };
+
         PbvdTable( const DeckItem& item );
 
         const TableColumn& getDepthColumn() const;
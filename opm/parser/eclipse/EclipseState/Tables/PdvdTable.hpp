@@ -27,6 +27,8 @@ namespace Opm {
 
     class PdvdTable : public SimpleTable {
     public:
+        enum class Column : size_t { DEPTH, PDEW };
+
         PdvdTable( const DeckItem& item );
 
         const TableColumn& getDepthColumn() const;
@@ -27,6 +27,8 @@ namespace Opm {
 
     class PlyadsTable : public SimpleTable {
         public:
+            enum class Column : size_t { PolymerConcentration, AdsorbedPolymer };
+
             PlyadsTable( const DeckItem& item );
 
             const TableColumn& getPolymerConcentrationColumn() const;
@@ -27,6 +27,8 @@ namespace Opm {
 
     class PlydhflfTable : public SimpleTable {
     public:
+        enum class Column : size_t { Temperature, PolymerHalflife };
+
 
         PlydhflfTable( const DeckItem& item );
 
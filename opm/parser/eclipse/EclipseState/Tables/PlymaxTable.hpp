@@ -27,6 +27,8 @@ namespace Opm {
 
     class PlymaxTable : public SimpleTable {
         public:
+            enum class Column : size_t { C_POLYMER, C_POLYMER_MAX };
+
 
         PlymaxTable( const DeckRecord& record );
 
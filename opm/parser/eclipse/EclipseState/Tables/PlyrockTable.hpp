@@ -27,6 +27,8 @@ namespace Opm {
 
     class PlyrockTable : public SimpleTable {
     public:
+        enum class Column : size_t { DeadPoreVolume, ResidualResistanceFactor, RockDensityFactor, AdsorbtionIndex, MaxAdsorbtion };
+
 
         // This is not really a table; every column has only one element.
         PlyrockTable( const DeckRecord& record );
@@ -30,6 +30,8 @@ namespace Opm {
 
     class PlyshlogTable : public SimpleTable {
     public:
+        enum class Column : size_t { WaterVelocity, ShearMultiplier };
+
         friend class TableManager;
 
         PlyshlogTable(const DeckRecord& indexRecord, const DeckRecord& dataRecord);
@@ -27,6 +27,8 @@ namespace Opm {
 
     class PlyviscTable : public SimpleTable {
     public:
+        enum class Column : size_t { PolymerConcentration, ViscosityMultiplier };
+
         PlyviscTable( const DeckItem& item );
 
         const TableColumn& getPolymerConcentrationColumn() const;
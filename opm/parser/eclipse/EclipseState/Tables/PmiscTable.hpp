@@ -28,6 +28,8 @@ namespace Opm {
 
     class PmiscTable : public SimpleTable {
     public:
+        enum class Column : size_t { OilPhasePressure, Miscibility };
+
 
         explicit PmiscTable( const DeckItem& item );
 
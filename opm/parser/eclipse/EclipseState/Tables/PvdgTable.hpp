@@ -27,6 +27,8 @@ namespace Opm {
 
     class PvdgTable : public SimpleTable {
         public:
+            enum class Column : size_t { P, BG, MUG };
+
             PvdgTable( const DeckItem& item );
 
             const TableColumn& getPressureColumn() const;
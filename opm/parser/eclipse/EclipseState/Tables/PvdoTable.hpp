@@ -27,6 +27,8 @@ namespace Opm {
 
     class PvdoTable : public SimpleTable {
     public:
+        enum class Column : size_t { P, BO, MUO };
+
 
         PvdoTable( const DeckItem& item );
 
@@ -28,6 +28,8 @@ namespace Opm {
 
     class PvdsTable : public SimpleTable {
     public:
+        enum class Column : size_t { P, BG, MUG };
+
         PvdsTable( const DeckItem& item );
 
         const TableColumn& getPressureColumn() const;
@@ -19,6 +19,8 @@
 #ifndef OPM_PARSER_PVTX_TABLE_HPP
 #define	OPM_PARSER_PVTX_TABLE_HPP
 
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include <opm/parser/eclipse/EclipseState/Tables/ColumnSchema.hpp>
@@ -100,6 +102,13 @@ undersaturated table looks like:
      150.00      1.08984     1.453
 
 The first row actually corresponds to saturated values.
+
+In addition to the SimpleTable instances the undersaturated tables are
+stored packed in one contiguous buffer, column by column, with an
+offset table giving the rows of each undersaturated table. The
+evaluate() overloads which take a column index work on the packed
+storage, and can evaluate a batch of (table, outer, inner) arguments in
+one call.
 */
 
 
@@ -117,6 +126,29 @@ The first row actually corresponds to saturated values.
         void init(const DeckKeyword& keyword, size_t tableIdx);
         size_t size() const;
         double evaluate(const std::string& column, double outerArg, double innerArg) const;
+        double evaluate(size_t columnIndex, double outerArg, double innerArg) const;
+
+        /*
+          Evaluates column @columnIndex of the undersaturated tables for
+          all argument pairs; the outer lookup is fastest when the outer
+          arguments are sorted.
+        */
+        std::vector<double> evaluate(size_t columnIndex,
+                                     const std::vector<double>& outerArgs,
+                                     const std::vector<double>& innerArgs) const;
+
+        /*
+          Batch evaluation over the tables of several regions, element i
+          is evaluated in tables[ tableIdx[i] ] - i.e. the table indices
+          are zero based.
+        */
+        template <typename PvtxTableType>
+        static std::vector<double> evaluate(const std::vector<PvtxTableType>& tables,
+                                            size_t columnIndex,
+                                            const std::vector<int>& tableIdx,
+                                            const std::vector<double>& outerArgs,
+                                            const std::vector<double>& innerArgs);
+
         double getArgValue(size_t index) const;
         const SimpleTable& getSaturatedTable() const;
 
@@ -127,6 +159,10 @@ The first row actually corresponds to saturated values.
         std::vector< SimpleTable >::const_iterator begin() const;
         std::vector< SimpleTable >::const_iterator end()   const;
     protected:
+        void packUnderSaturatedTables();
+        void assertColumnIndex(size_t columnIndex) const;
+        double evaluateUnderSaturated(size_t tableNumber, size_t columnIndex, double innerArg) const;
+
         ColumnSchema m_outerColumnSchema;
         TableColumn m_outerColumn;
 
@@ -134,8 +170,44 @@ The first row actually corresponds to saturated values.
         TableSchema m_saturatedSchema;
         std::vector< SimpleTable > m_underSaturatedTables;
         SimpleTable m_saturatedTable;
+
+        /*
+          Column c of undersaturated table i occupies the elements
+          [m_packedOffset[i], m_packedOffset[i + 1]) of the range
+          starting at c * m_packedOffset.back() in m_packedColumns.
+        */
+        std::vector<size_t> m_packedOffset;
+        std::vector<double> m_packedColumns;
+        bool m_packedDescending = false;
     };
 
+
+    template <typename PvtxTableType>
+    std::vector<double> PvtxTable::evaluate(const std::vector<PvtxTableType>& tables,
+                                            size_t columnIndex,
+                                            const std::vector<int>& tableIdx,
+                                            const std::vector<double>& outerArgs,
+                                            const std::vector<double>& innerArgs) {
+        const long size = tableIdx.size();
+        if (outerArgs.size() != tableIdx.size() || innerArgs.size() != tableIdx.size())
+            throw std::invalid_argument("Size mismatch between table index and argument vectors");
+
+        for (const int idx : tableIdx) {
+            if (idx < 0 || static_cast<size_t>(idx) >= tables.size())
+                throw std::invalid_argument("Invalid table index: " + std::to_string( idx ));
+        }
+
+        for (const auto& table : tables)
+            table.assertColumnIndex( columnIndex );
+
+        std::vector<double> values( size );
+#pragma omp parallel for schedule(static)
+        for (long i = 0; i < size; i++)
+            values[i] = tables[ tableIdx[i] ].evaluate( columnIndex, outerArgs[i], innerArgs[i] );
+
+        return values;
+    }
+
 }
 
 #endif
@@ -27,6 +27,8 @@ namespace Opm {
 
     class RocktabTable : public  SimpleTable {
     public:
+        enum class Column : size_t { PO, PV_MULT, PV_MULT_TRAN = 2, PV_MULT_TRANX = 2, PV_MULT_TRANY = 3, PV_MULT_TRANZ = 4 };
+
         RocktabTable(const DeckItem& item,
                      bool isDirectional,
                      bool hasStressOption);
@@ -27,6 +27,8 @@ namespace Opm {
 
     class RsvdTable : public SimpleTable {
     public:
+        enum class Column : size_t { DEPTH, RS };
+
         RsvdTable( const DeckItem& item );
 
         const TableColumn& getDepthColumn() const;
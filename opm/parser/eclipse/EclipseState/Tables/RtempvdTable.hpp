@@ -27,6 +27,8 @@ namespace Opm {
 
     class RtempvdTable : public SimpleTable {
     public:
+        enum class Column : size_t { Depth, Temperature };
+
         RtempvdTable( const DeckItem& item );
 
         const TableColumn& getDepthColumn() const;
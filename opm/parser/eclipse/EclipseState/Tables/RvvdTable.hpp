@@ -27,6 +27,8 @@ namespace Opm {
 
     class RvvdTable : public SimpleTable {
     public:
+        enum class Column : size_t { DEPTH, RV };
+
         RvvdTable( const DeckItem& item );
 
         const TableColumn& getDepthColumn() const;
@@ -28,6 +28,8 @@ namespace Opm {
 
     class SgcwmisTable : public SimpleTable {
     public:
+        enum class Column : size_t { WaterSaturation, MiscibleResidualGasSaturation };
+
         explicit SgcwmisTable( const DeckItem& item );
 
         const TableColumn& getWaterSaturationColumn() const;
@@ -28,6 +28,8 @@ namespace Opm {
     class SgfnTable : public SimpleTable {
 
     public:
+        enum class Column : size_t { SG, KRG, PCOG };
+
         SgfnTable( const DeckItem& item, const bool jfunc );
 
         const TableColumn& getSgColumn() const;
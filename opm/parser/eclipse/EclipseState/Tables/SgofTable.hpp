@@ -27,6 +27,8 @@ namespace Opm {
     class SgofTable : public SimpleTable {
 
     public:
+        enum class Column : size_t { SG, KRG, KROG, PCOG };
+
         SgofTable( const DeckItem& item, const bool jfunc );
 
         const TableColumn& getSgColumn() const;
@@ -28,6 +28,8 @@ namespace Opm {
     class SgwfnTable : public SimpleTable {
 
     public:
+        enum class Column : size_t { SG, KRG, KRGW, PCGW };
+
         SgwfnTable( const DeckItem& item );
         const TableColumn& getSgColumn() const;
         const TableColumn& getKrgColumn() const;
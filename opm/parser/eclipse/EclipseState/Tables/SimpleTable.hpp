@@ -26,6 +26,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace Opm {
@@ -50,6 +51,18 @@ namespace Opm {
         TableColumn& getColumn(const std::string &name);
         TableColumn& getColumn(size_t colIdx);
 
+        /*
+          The concrete table classes enumerate their columns in schema
+          order as a nested 'enum class Column', i.e. SwofTable::Column::KRW
+          can be used in place of the string "KRW" and resolves to the
+          column without a name lookup.
+        */
+        template <typename ColumnEnum,
+                  typename = typename std::enable_if<std::is_enum<ColumnEnum>::value>::type>
+        const TableColumn& getColumn(ColumnEnum column) const {
+            return getColumn( static_cast<size_t>(column) );
+        }
+
         double get(const std::string& column  , size_t row) const;
         double get(size_t column  , size_t row) const;
         /*!
@@ -59,6 +72,13 @@ namespace Opm {
          * X coordinate.
          */
         double evaluate(const std::string& columnName, double xPos) const;
+        double evaluate(size_t columnIndex, double xPos) const;
+
+        template <typename ColumnEnum,
+                  typename = typename std::enable_if<std::is_enum<ColumnEnum>::value>::type>
+        double evaluate(ColumnEnum column, double xPos) const {
+            return evaluate( static_cast<size_t>(column), xPos );
+        }
 
         /// throws std::invalid_argument if jf != m_jfunc
         void assertJFuncPressure(const bool jf) const;
@@ -28,6 +28,8 @@ namespace Opm {
     class SlgofTable : public SimpleTable {
 
     public:
+        enum class Column : size_t { SL, KRG, KROG, PCOG };
+
         SlgofTable( const DeckItem& item, const bool jfunc );
         const TableColumn& getSlColumn() const;
         const TableColumn& getKrgColumn() const;
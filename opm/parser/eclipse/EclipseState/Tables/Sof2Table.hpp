@@ -27,6 +27,8 @@ namespace Opm {
 
     class Sof2Table : public SimpleTable {
         public:
+            enum class Column : size_t { SO, KRO };
+
             Sof2Table( const DeckItem& item );
 
             const TableColumn& getSoColumn() const;
@@ -27,6 +27,8 @@ namespace Opm {
 
     class Sof3Table : public SimpleTable {
         public:
+            enum class Column : size_t { SO, KROW, KROG };
+
             Sof3Table( const DeckItem& item );
 
             const TableColumn& getSoColumn() const;
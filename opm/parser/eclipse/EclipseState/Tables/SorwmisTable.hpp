@@ -28,6 +28,8 @@ namespace Opm {
 
     class SorwmisTable : public SimpleTable {
     public:
+        enum class Column : size_t { WaterSaturation, MiscibleResidualOilSaturation };
+
 
         explicit SorwmisTable( const DeckItem& item );
 
@@ -28,6 +28,8 @@ namespace Opm {
     // not for a way to cheat on the SPE test cases ;)
     class SpecheatTable : public SimpleTable {
     public:
+        enum class Column : size_t { TEMPERATURE, CV_OIL, CV_WATER, CV_GAS };
+
         SpecheatTable(const DeckItem& item);
 
         const TableColumn& getTemperatureColumn() const;
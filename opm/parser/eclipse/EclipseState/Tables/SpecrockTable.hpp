@@ -27,6 +27,8 @@ namespace Opm {
     // pore space.
     class SpecrockTable : public SimpleTable {
     public:
+        enum class Column : size_t { TEMPERATURE, CV_ROCK };
+
         SpecrockTable(const DeckItem& item);
 
         const TableColumn& getTemperatureColumn() const;
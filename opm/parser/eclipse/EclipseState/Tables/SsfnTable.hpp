@@ -27,6 +27,8 @@ namespace Opm {
 
     class SsfnTable : public SimpleTable {
         public:
+            enum class Column : size_t { SolventFraction, GasRelPermMultiplier, SolventRelPermMultiplier };
+
             friend class TableManager;
             SsfnTable( const DeckItem& item );
 
@@ -25,6 +25,8 @@ namespace Opm {
     class SwfnTable : public SimpleTable {
 
     public:
+        enum class Column : size_t { SW, KRW, PCOW };
+
         SwfnTable( const DeckItem& item, const bool jfunc );
 
         const TableColumn& getSwColumn() const;
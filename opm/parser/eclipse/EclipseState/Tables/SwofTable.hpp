@@ -27,6 +27,8 @@ namespace Opm {
 
     class SwofTable : public SimpleTable {
     public:
+        enum class Column : size_t { SW, KRW, KROW, PCOW };
+
         SwofTable( const DeckItem& item, const bool jfunc );
         const TableColumn& getSwColumn() const;
         const TableColumn& getKrwColumn() const;
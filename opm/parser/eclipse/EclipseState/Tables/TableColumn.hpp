@@ -52,7 +52,19 @@ namespace Opm {
            is out of range.
         */
         TableIndex lookup(double argValue) const;
+
+        /*
+           As lookup(), but the search starts in the interval @hint,
+           which is updated to the interval containing @argValue. For a
+           monotone sequence of arguments consecutive lookups will
+           typically hit the same or the neighbouring interval. The
+           result is identical to the plain lookup().
+        */
+        TableIndex lookup(double argValue, size_t& hint) const;
+        std::vector<TableIndex> lookup(const std::vector<double>& argValues) const;
+
         double eval( const TableIndex& index) const;
+        std::vector<double> eval( const std::vector<TableIndex>& indices) const;
         void applyDefaults( const TableColumn& argColumn );
         void assertUnitRange() const;
         TableColumn& operator= (const TableColumn& other);
@@ -64,12 +76,22 @@ namespace Opm {
         void assertUpdate(size_t index, double value) const;
         void assertPrevious(size_t index , double value) const;
         void assertNext(size_t index , double value) const;
+        void assertLookup() const;
+        void updateExtrema();
+        TableIndex intervalIndex(size_t intervalIdx, double argValue) const;
 
         ColumnSchema m_schema;
         std::string m_name;
         std::vector<double> m_values;
         std::vector<bool> m_default;
         size_t m_defaultCount;
+
+        /*
+          Index of the (first) minimum and maximum value; only
+          maintained for ordered columns without defaulted values.
+        */
+        size_t m_minIndex = 0;
+        size_t m_maxIndex = 0;
     };
 
 
@@ -28,6 +28,8 @@ namespace Opm {
 
     class TlpmixpaTable : public SimpleTable {
     public:
+        enum class Column : size_t { OilPhasePressure, Miscibility };
+
         TlpmixpaTable( const DeckItem& item );
 
         const TableColumn& getOilPhasePressureColumn() const;
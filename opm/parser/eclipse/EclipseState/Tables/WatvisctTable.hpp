@@ -25,6 +25,8 @@ namespace Opm {
 
     class WatvisctTable : public SimpleTable {
     public:
+        enum class Column : size_t { Temperature, Viscosity };
+
         WatvisctTable( const DeckItem& item );
 
         const TableColumn& getTemperatureColumn() const;
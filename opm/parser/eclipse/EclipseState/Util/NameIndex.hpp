@@ -0,0 +1,85 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPM_NAME_INDEX_HPP
+#define OPM_NAME_INDEX_HPP
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace Opm {
+
+/*
+  The NameIndex class keeps the names of an OrderedMap sorted, so that
+  all the names starting with a given prefix - i.e. the names matched by
+  a well or group pattern like 'OP*' - can be found with a binary search
+  followed by a walk over the matches, instead of testing every name in
+  the map. The matches are returned as positions in the OrderedMap,
+  sorted in insertion order.
+
+  Resolved prefixes can be cached with cachedPrefixMatch(); the cache is
+  cleared whenever a new name is inserted.
+*/
+
+class NameIndex {
+public:
+    void insert(const std::string& name, size_t index) {
+        m_names[name] = index;
+        m_cache.clear();
+    }
+
+
+    size_t size() const {
+        return m_names.size();
+    }
+
+
+    std::vector<size_t> prefixMatch(const std::string& prefix) const {
+        std::vector<size_t> indices;
+        for (auto iter = m_names.lower_bound(prefix); iter != m_names.end(); ++iter) {
+            if (iter->first.compare(0, prefix.size(), prefix) != 0)
+                break;
+
+            indices.push_back(iter->second);
+        }
+
+        std::sort(indices.begin(), indices.end());
+        return indices;
+    }
+
+
+    const std::vector<size_t>& cachedPrefixMatch(const std::string& prefix) {
+        auto iter = m_cache.find(prefix);
+        if (iter == m_cache.end())
+            iter = m_cache.emplace(prefix, this->prefixMatch(prefix)).first;
+
+        return iter->second;
+    }
+
+private:
+    std::map<std::string, size_t> m_names;
+    std::unordered_map<std::string, std::vector<size_t>> m_cache;
+};
+}
+
+#endif
@@ -39,7 +39,7 @@
 #include <sstream>
 #include <string>
 #include <vector>
-#include <map>
+#include <algorithm>
 #include <cmath>
 
 using namespace std;
@@ -56,6 +56,14 @@ using namespace std;
    - sorting slightly more complex.
    - insertion of further values bad.
 
+   ** This is used currently: **
+  three vectors x, f and d, sorted on x
+   - contiguous storage, evaluation is a binary search in the x
+     values followed by direct indexing in f and d.
+   - sorted (batch) evaluation can be done in one sweep.
+   - insertion of a single value is linear, but so is the
+     recomputation of the derivatives which follows anyway.
+
   vector<double,double>
    - easy sorting
    - code complexity almost as for map.
@@ -65,7 +73,6 @@ using namespace std;
    - nice code
    - not as sortable, insertion is cumbersome.
 
-   ** This is used currently: **
   map<double, double> one for (x,f) and one for (x,d)
    - Naturally sorted on x-values (done by the map-construction)
    - Slower to set up, awkward loop coding (?)
@@ -90,6 +97,10 @@ using namespace std;
   insertion of a new data pair, everything is recomputed. Revisit
   this when needed.
 
+  The derivatives and monotonicity flags are always recomputed when
+  the data points change, never lazily from a const member function;
+  hence concurrent evaluation of the same object is safe.
+
 */
 
 
@@ -103,22 +114,49 @@ MonotCubicInterpolator(const vector<double> & x, const vector<double> & f) {
     throw("Unable to constuct MonotCubicInterpolator from vectors.") ;
   }
 
-  // Add the contents of the input vectors to our map of values.
-  vector<double>::const_iterator posx, posf;
-  for (posx = x.begin(), posf = f.begin(); posx != x.end(); ++posx, ++posf) {
-    data[*posx] = *posf ;
+  vector<pair<double,double> > xf;
+  xf.reserve(x.size());
+  for (size_t i = 0; i < x.size(); ++i) {
+    xf.push_back(make_pair(x[i], f[i]));
   }
 
+  sortData(xf);
   computeInternalFunctionData();
 }
 
 
 
+void
+MonotCubicInterpolator::
+sortData(vector<pair<double,double> > & xf)
+{
+  // Stable sort, so that the last of several points with equal
+  // x-value can be picked; this is the point which would have
+  // survived repeated assignment data[x] = f.
+  stable_sort(xf.begin(), xf.end(),
+              [](const pair<double,double>& a, const pair<double,double>& b) { return a.first < b.first; });
+
+  xdata.clear();
+  fdata.clear();
+  xdata.reserve(xf.size());
+  fdata.reserve(xf.size());
+  for (size_t i = 0; i < xf.size(); ++i) {
+    if (i + 1 < xf.size() && xf[i + 1].first == xf[i].first) {
+      continue;
+    }
+    xdata.push_back(xf[i].first);
+    fdata.push_back(xf[i].second);
+  }
+}
+
+
+
 bool
 MonotCubicInterpolator::
 read(const std::string & datafilename, int xColumn, int fColumn)
 {
-  data.clear() ;
+  xdata.clear() ;
+  fdata.clear() ;
   ddata.clear() ;
 
   ifstream datafile_fs(datafilename.c_str());
@@ -126,6 +164,7 @@ read(const std::string & datafilename, int xColumn, int fColumn)
     return false ;
   }
 
+  vector<pair<double,double> > xf;
   string linestring;
   while (!datafile_fs.eof()) {
     getline(datafile_fs, linestring);
@@ -150,15 +189,16 @@ read(const std::string & datafilename, int xColumn, int fColumn)
         }
     }
     if (columnindex >= (max(xColumn, fColumn))) {
-      data[value[xColumn-1]] =  value[fColumn-1] ;
+      xf.push_back(make_pair(value[xColumn-1], value[fColumn-1]));
     }
   }
   datafile_fs.close();
 
-  if (data.size() == 0) {
+  if (xf.size() == 0) {
     return false ;
   }
 
+  sortData(xf);
   computeInternalFunctionData();
   return true ;
 }
@@ -170,7 +210,16 @@ addPair(double newx, double newf) {
   if (std::isnan(newx) || std::isinf(newx) || std::isnan(newf) || std::isinf(newf)) {
     throw("MonotCubicInterpolator: addPair() received inf/nan input.");
   }
-  data[newx] = newf ;
+
+  const auto pos = lower_bound(xdata.begin(), xdata.end(), newx);
+  const auto index = pos - xdata.begin();
+  if (pos != xdata.end() && *pos == newx) {
+    fdata[index] = newf;
+  }
+  else {
+    xdata.insert(pos, newx);
+    fdata.insert(fdata.begin() + index, newf);
+  }
 
   // In a critical application, we should only update the
   // internal function data for the offended interval,
@@ -181,55 +230,84 @@ addPair(double newx, double newf) {
 
 double
 MonotCubicInterpolator::
-evaluate(double x) const {
-
-  if (std::isnan(x) || std::isinf(x)) {
-    throw("MonotCubicInterpolator: evaluate() received inf/nan input.");
-  }
-
-  // xf becomes the first (xdata,fdata) pair where xdata >= x
-  map<double,double>::const_iterator xf_iterator = data.lower_bound(x);
+evaluateAt(size_t upper, double x) const {
 
   // First check if we must extrapolate:
-  if (xf_iterator == data.begin()) {
-    if (data.begin()->first == x) { // Just on the interval limit
-      return data.begin()->second;
-    }
-    else {
+  if (upper == 0) {
       // Constant extrapolation (!!)
-      return data.begin()->second;
-    }
+      return fdata.front();
   }
-  if (xf_iterator == data.end()) {
+  if (upper == xdata.size()) {
       // Constant extrapolation (!!)
-      return data.rbegin()->second;
+      return fdata.back();
   }
 
-
   // Ok, we have x_min < x < x_max
-
-  pair<double,double> xf2 = *xf_iterator;
-  pair<double,double> xf1 = *(--xf_iterator);
-  // we now have: xf2.first > x
+  const size_t lower = upper - 1;
+  const double h = xdata[upper] - xdata[lower];
 
   // Linear interpolation if derivative data is not available:
-  if (ddata.size() != data.size()) {
-    double finterp =  xf1.second +
-      (xf2.second - xf1.second) / (xf2.first - xf1.first)
-      * (x - xf1.first);
+  if (ddata.size() != xdata.size()) {
+    double finterp =  fdata[lower] +
+      (fdata[upper] - fdata[lower]) / h
+      * (x - xdata[lower]);
     return finterp;
   }
   else { // Do Cubic Hermite spline
-    double t = (x - xf1.first)/(xf2.first - xf1.first); // t \in [0,1]
-    double h = xf2.first - xf1.first;
+    double t = (x - xdata[lower])/h; // t \in [0,1]
     double finterp
-      = xf1.second       * H00(t)
-      + ddata[xf1.first] * H10(t) * h
-      + xf2.second       * H01(t)
-      + ddata[xf2.first] * H11(t) * h ;
+      = fdata[lower] * H00(t)
+      + ddata[lower] * H10(t) * h
+      + fdata[upper] * H01(t)
+      + ddata[upper] * H11(t) * h ;
     return finterp;
   }
+}
+
+
+double
+MonotCubicInterpolator::
+evaluate(double x) const {
+
+  if (std::isnan(x) || std::isinf(x)) {
+    throw("MonotCubicInterpolator: evaluate() received inf/nan input.");
+  }
 
+  // The first data point with xdata >= x
+  const auto upper = lower_bound(xdata.begin(), xdata.end(), x) - xdata.begin();
+  return evaluateAt(upper, x);
+}
+
+
+vector<double>
+MonotCubicInterpolator::
+evaluate(const vector<double> & x) const {
+
+  vector<double> f(x.size());
+
+  // upper is the first data point with xdata >= x[i]; for increasing
+  // x it only moves forward, i.e. sorted input is merged with the
+  // data points in one sweep.
+  size_t upper = 0;
+  for (size_t i = 0; i < x.size(); ++i) {
+    if (std::isnan(x[i]) || std::isinf(x[i])) {
+      throw("MonotCubicInterpolator: evaluate() received inf/nan input.");
+    }
+
+    if (i > 0 && x[i] < x[i - 1]) {
+      upper = lower_bound(xdata.begin(), xdata.begin() + upper, x[i]) - xdata.begin();
+    }
+    else if (upper < xdata.size() && xdata[upper] < x[i]) {
+      ++upper;
+      if (upper < xdata.size() && xdata[upper] < x[i]) {
+        upper = lower_bound(xdata.begin() + upper, xdata.end(), x[i]) - xdata.begin();
+      }
+    }
+
+    f[i] = evaluateAt(upper, x[i]);
+  }
+
+  return f;
 }
 
 
@@ -245,14 +323,7 @@ vector<double>
 MonotCubicInterpolator::
 get_xVector() const
 {
-  map<double,double>::const_iterator xf_iterator = data.begin();
-
-  vector<double> outputvector;
-  outputvector.reserve(data.size());
-  for (xf_iterator = data.begin(); xf_iterator != data.end(); ++xf_iterator) {
-    outputvector.push_back(xf_iterator->first);
-  }
-  return outputvector;
+  return xdata;
 }
 
 
@@ -260,15 +331,7 @@ vector<double>
 MonotCubicInterpolator::
 get_fVector() const
 {
-
-  map<double,double>::const_iterator xf_iterator = data.begin();
-
-  vector<double> outputvector;
-  outputvector.reserve(data.size());
-  for (xf_iterator = data.begin(); xf_iterator != data.end(); ++xf_iterator) {
-    outputvector.push_back(xf_iterator->second);
-  }
-  return outputvector;
+  return fdata;
 }
 
 
@@ -279,19 +342,17 @@ toString() const
 {
   const int precision = 20;
   std::stringstream dataStringStream;
-  for (map<double,double>::const_iterator it = data.begin();
-       it != data.end(); ++it) {
-      dataStringStream << setprecision(precision) << it->first;
+  for (size_t i = 0; i < xdata.size(); ++i) {
+    dataStringStream << setprecision(precision) << xdata[i];
     dataStringStream << '\t';
-    dataStringStream << setprecision(precision) << it->second;
+    dataStringStream << setprecision(precision) << fdata[i];
     dataStringStream << '\n';
   }
   dataStringStream << "Derivative values:" << endl;
-  for (map<double,double>::const_iterator it = ddata.begin();
-       it != ddata.end(); ++it) {
-    dataStringStream << setprecision(precision) << it->first;
+  for (size_t i = 0; i < ddata.size(); ++i) {
+    dataStringStream << setprecision(precision) << xdata[i];
     dataStringStream << '\t';
-    dataStringStream << setprecision(precision) << it->second;
+    dataStringStream << setprecision(precision) << ddata[i];
     dataStringStream << '\n';
   }
 
@@ -304,30 +365,24 @@ pair<double,double>
 MonotCubicInterpolator::
 getMissingX() const
 {
-  if( data.size() < 2) {
+  if( xdata.size() < 2) {
     throw("MonotCubicInterpolator::getMissingX() only one datapoint.");
   }
 
   // Search for biggest difference value in function-datavalues:
 
-  map<double,double>::const_iterator  maxfDiffPair_iterator = data.begin();;
+  size_t maxfDiffIndex = 0;
   double maxfDiffValue = 0;
 
-  map<double,double>::const_iterator xf_iterator;
-  map<double,double>::const_iterator xf_next_iterator;
-
-  for (xf_iterator = data.begin(), xf_next_iterator = ++(data.begin());
-       xf_next_iterator != data.end();
-       ++xf_iterator, ++xf_next_iterator) {
-    double absfDiff = fabs((double)(*xf_next_iterator).second
-                           - (double)(*xf_iterator).second);
+  for (size_t i = 0; i + 1 < fdata.size(); ++i) {
+    double absfDiff = fabs(fdata[i + 1] - fdata[i]);
     if (absfDiff > maxfDiffValue) {
-      maxfDiffPair_iterator = xf_iterator;
+      maxfDiffIndex = i;
       maxfDiffValue = absfDiff;
     }
   }
 
-  double newXvalue = ((*maxfDiffPair_iterator).first + ((*(++maxfDiffPair_iterator)).first))/2;
+  double newXvalue = (xdata[maxfDiffIndex] + xdata[maxfDiffIndex + 1])/2;
   return make_pair(newXvalue, maxfDiffValue);
 
 }
@@ -337,22 +392,21 @@ getMissingX() const
 pair<double,double>
 MonotCubicInterpolator::
 getMaximumF() const {
-  if (data.size() <= 1) {
+  if (xdata.size() <= 1) {
     throw ("MonotCubicInterpolator::getMaximumF() empty data.") ;
   }
   if (strictlyIncreasing)
-    return *data.rbegin();
+    return getMaximumX();
   else if (strictlyDecreasing)
-    return *data.begin();
+    return getMinimumX();
   else {
-    pair<double,double> maxf = *data.rbegin() ;
-    map<double,double>::const_iterator xf_iterator;
-    for (xf_iterator = data.begin() ; xf_iterator != data.end(); ++xf_iterator) {
-      if (xf_iterator->second > maxf.second) {
-        maxf = *xf_iterator ;
+    size_t maxIndex = fdata.size() - 1;
+    for (size_t i = 0; i < fdata.size(); ++i) {
+      if (fdata[i] > fdata[maxIndex]) {
+        maxIndex = i;
       } ;
     }
-    return maxf ;
+    return make_pair(xdata[maxIndex], fdata[maxIndex]) ;
   }
 }
 
@@ -360,47 +414,60 @@ getMaximumF() const {
 pair<double,double>
 MonotCubicInterpolator::
 getMinimumF() const {
-  if (data.size() <= 1) {
+  if (xdata.size() <= 1) {
     throw ("MonotCubicInterpolator::getMinimumF() empty data.") ;
   }
   if (strictlyIncreasing)
-    return *data.begin();
+    return getMinimumX();
   else if (strictlyDecreasing) {
-    return *data.rbegin();
+    return getMaximumX();
   }
   else {
-    pair<double,double> minf = *data.rbegin() ;
-    map<double,double>::const_iterator xf_iterator;
-    for (xf_iterator = data.begin() ; xf_iterator != data.end(); ++xf_iterator) {
-      if (xf_iterator->second < minf.second) {
-        minf = *xf_iterator ;
+    size_t minIndex = fdata.size() - 1;
+    for (size_t i = 0; i < fdata.size(); ++i) {
+      if (fdata[i] < fdata[minIndex]) {
+        minIndex = i;
       } ;
     }
-    return minf ;
+    return make_pair(xdata[minIndex], fdata[minIndex]) ;
   }
 }
 
 
 void
 MonotCubicInterpolator::
-computeInternalFunctionData() const {
+computeInternalFunctionData() {
 
   /* The contents of this function is meaningless if there is only one datapoint */
-  if (data.size() <= 1) {
+  if (xdata.size() <= 1) {
+    ddata.clear();
     return;
   }
 
-  /* We do not check the caching flag if we are instructed
-     to do this computation */
+  computeMonotoneness();
+  computeSimpleDerivatives();
+
+
+  // If our input data is monotone, we can do monotone cubic
+  // interpolation, so adjust the derivatives if so.
+  //
+  // If input data is not monotone, we should not touch
+  // the derivatives, as this code should reduce to a
+  // standard cubic interpolation algorithm.
+  if (monotone) {
+    adjustDerivativesForMonotoneness();
+  }
+}
+
+
+void
+MonotCubicInterpolator::
+computeMonotoneness() {
 
   /* We compute monotoneness and directions by assuming
      monotoneness, and setting to false if the function is not for
      some value */
 
-  map<double,double>::const_iterator xf_iterator;
-  map<double,double>::const_iterator xf_next_iterator;
-
-
   strictlyMonotone = true; // We assume this is true, and will set to false if not
   monotone = true;
   strictlyDecreasing = true;
@@ -408,57 +475,59 @@ computeInternalFunctionData() const {
   strictlyIncreasing = true;
   increasing = true;
 
+  const size_t n = fdata.size();
+  if (n <= 1) {
+    return;
+  }
+
   // Increasing or decreasing??
-  xf_iterator = data.begin();
-  xf_next_iterator = ++(data.begin());
+  size_t i = 0;
   /* Cater for non-strictness, search for direction for monotoneness */
-  while (xf_next_iterator != data.end() &&
-         xf_iterator->second == xf_next_iterator->second) {
+  while (i + 1 < n && fdata[i] == fdata[i + 1]) {
     /* Ok, equal values, this is not strict. */
     strictlyMonotone = false;
     strictlyIncreasing = false;
     strictlyDecreasing = false;
 
-    ++xf_iterator;
-    ++xf_next_iterator;
+    ++i;
   }
 
 
-  if (xf_next_iterator != data.end()) {
+  if (i + 1 < n) {
 
-    if ( xf_iterator->second > xf_next_iterator->second) {
+    if (fdata[i] > fdata[i + 1]) {
       // Ok, decreasing, check monotoneness:
       strictlyDecreasing = true;// if strictlyMonotone == false, this one should not be trusted anyway
       decreasing = true;
       strictlyIncreasing = false;
       increasing = false;
-      while(++xf_iterator, ++xf_next_iterator != data.end()) {
-        if ((*xf_iterator).second <  (*xf_next_iterator).second) {
+      while (++i + 1 < n) {
+        if (fdata[i] < fdata[i + 1]) {
           monotone = false;
           strictlyMonotone = false;
           strictlyDecreasing = false; // meaningless now
           break; // out of while loop
         }
-        if ((*xf_iterator).second <= (*xf_next_iterator).second) {
+        if (fdata[i] <= fdata[i + 1]) {
           strictlyMonotone = false;
           strictlyDecreasing = false; // meaningless now
         }
       }
     }
-    else if (xf_iterator->second < xf_next_iterator->second) {
+    else if (fdata[i] < fdata[i + 1]) {
       // Ok, assume increasing, check monotoneness:
       strictlyDecreasing = false;
       strictlyIncreasing = true;
       decreasing = false;
       increasing = true;
-      while(++xf_iterator, ++xf_next_iterator != data.end()) {
-        if ((*xf_iterator).second >  (*xf_next_iterator).second) {
+      while (++i + 1 < n) {
+        if (fdata[i] > fdata[i + 1]) {
           monotone = false;
           strictlyMonotone = false;
           strictlyIncreasing = false; // meaningless now
           break; // out of while loop
         }
-        if ((*xf_iterator).second >= (*xf_next_iterator).second) {
+        if (fdata[i] >= fdata[i + 1]) {
           strictlyMonotone = false;
           strictlyIncreasing = false; // meaningless now
         }
@@ -472,21 +541,6 @@ computeInternalFunctionData() const {
     }
 
   }
-  computeSimpleDerivatives();
-
-
-  // If our input data is monotone, we can do monotone cubic
-  // interpolation, so adjust the derivatives if so.
-  //
-  // If input data is not monotone, we should not touch
-  // the derivatives, as this code should reduce to a
-  // standard cubic interpolation algorithm.
-  if (monotone) {
-    adjustDerivativesForMonotoneness();
-  }
-
-  strictlyMonotoneCached = true;
-  monotoneCached = true;
 }
 
 //       Checks if the function curve is flat (zero derivative) at the
@@ -514,35 +568,24 @@ chopFlatEndpoints(const double epsilon) {
         return;
     }
 
-    map<double,double>::iterator xf_iterator;
-    map<double,double>::iterator xf_next_iterator;
-
-    // Clear flags:
-    strictlyMonotoneCached = false;
-    monotoneCached = false;
-
     // Chop left end:
-    xf_iterator = data.begin();
-    xf_next_iterator = ++(data.begin());
     // Erase data points that are similar to its right value from the left end.
-    while ((xf_next_iterator != data.end()) &&
-           (fabs(xf_iterator->second - xf_next_iterator->second) < epsilon )) {
-        ++xf_next_iterator;
-        data.erase(xf_iterator);
-        ++xf_iterator;
+    size_t first = 0;
+    while ((first + 1 < fdata.size()) &&
+           (fabs(fdata[first] - fdata[first + 1]) < epsilon )) {
+        ++first;
     }
+    xdata.erase(xdata.begin(), xdata.begin() + first);
+    fdata.erase(fdata.begin(), fdata.begin() + first);
 
-    xf_iterator = data.end();
-    --xf_iterator;   // (data.end() points beyond the last element)
-    xf_next_iterator = xf_iterator;
-    --xf_next_iterator;
     // Erase data points that are similar to its left value from the right end.
-    while ((xf_next_iterator != data.begin()) &&
-           (fabs(xf_iterator->second - xf_next_iterator->second) < epsilon )) {
-        --xf_next_iterator;
-        data.erase(xf_iterator);
-        --xf_iterator;
+    size_t last = fdata.size() - 1;
+    while ((last > 1) &&
+           (fabs(fdata[last] - fdata[last - 1]) < epsilon )) {
+        --last;
     }
+    xdata.erase(xdata.begin() + last + 1, xdata.end());
+    fdata.erase(fdata.begin() + last + 1, fdata.end());
 
     // Finished chopping, so recompute function data:
     computeInternalFunctionData();
@@ -572,10 +615,6 @@ shrinkFlatAreas(const double epsilon) {
         return;
     }
 
-    map<double,double>::iterator xf_iterator;
-    map<double,double>::iterator xf_next_iterator;
-
-
     // Nothing to do if we already are strictly monotone
     if (isStrictlyMonotone()) {
         return;
@@ -586,85 +625,49 @@ shrinkFlatAreas(const double epsilon) {
         return;
     }
 
-    // Clear flags, they are not to be trusted after we modify the
-    // data
-    strictlyMonotoneCached = false;
-    monotoneCached = false;
-
     // Iterate through data values, if two data pairs
     // have equal values, delete one of the data pair.
     // Do not trust the source code on which data point is being
     // removed (x-values of equal y-points might be averaged in the future)
-    xf_iterator = data.begin();
-    xf_next_iterator = ++(data.begin());
-
-    while (xf_next_iterator != data.end()) {
-        //cout << xf_iterator->first << "," << xf_iterator->second << " " << xf_next_iterator->first << "," << xf_next_iterator->second << "\n";
-        if (fabs(xf_iterator->second - xf_next_iterator->second) < epsilon ) {
-            //cout << "erasing data pair" << xf_next_iterator->first << " " << xf_next_iterator->second << "\n";
-            map <double,double>::iterator xf_tobedeleted_iterator = xf_next_iterator;
-            ++xf_next_iterator;
-            data.erase(xf_tobedeleted_iterator);
-        }
-        else {
-            ++xf_iterator;
-            ++xf_next_iterator;
+    size_t kept = 0;
+    for (size_t next = 1; next < fdata.size(); ++next) {
+        if (fabs(fdata[kept] - fdata[next]) >= epsilon ) {
+            ++kept;
+            xdata[kept] = xdata[next];
+            fdata[kept] = fdata[next];
         }
     }
+    xdata.resize(kept + 1);
+    fdata.resize(kept + 1);
 
+    computeInternalFunctionData();
 }
 
 
 void
 MonotCubicInterpolator::
-computeSimpleDerivatives() const {
+computeSimpleDerivatives() {
 
-  ddata.clear();
+  const size_t n = xdata.size();
+  ddata.resize(n);
 
   // Do endpoints first:
-  map<double,double>::const_iterator xf_iterator;
-  map<double,double>::const_iterator xf_next_iterator;
-  double diff;
-
   // Leftmost interval:
-  xf_iterator = data.begin();
-  xf_next_iterator = ++(data.begin());
-  diff =
-    (xf_next_iterator->second - xf_iterator->second) /
-    (xf_next_iterator->first  - xf_iterator->first);
-  ddata[xf_iterator->first] = diff ;
+  ddata[0] = (fdata[1] - fdata[0]) / (xdata[1] - xdata[0]);
 
   // Rightmost interval:
-  xf_iterator = --(--(data.end()));
-  xf_next_iterator = --(data.end());
-  diff =
-    (xf_next_iterator->second - xf_iterator->second) /
-    (xf_next_iterator->first  - xf_iterator->first);
-  ddata[xf_next_iterator->first] = diff ;
+  ddata[n - 1] = (fdata[n - 1] - fdata[n - 2]) / (xdata[n - 1] - xdata[n - 2]);
 
   // If we have more than two intervals, loop over internal points:
-  if (data.size() > 2) {
-
-    map<double,double>::const_iterator intpoint;
-    for (intpoint = ++data.begin(); intpoint != --data.end(); ++intpoint) {
+  for (size_t i = 1; i + 1 < n; ++i) {
       /*
         diff = (f2 - f1)/(x2-x1)/w + (f3-f1)/(x3-x2)/2
 
         average of the forward and backward difference.
         Weights are equal, should we weigh with h_i?
       */
-
-      map<double,double>::const_iterator lastpoint = intpoint; --lastpoint;
-      map<double,double>::const_iterator nextpoint = intpoint; ++nextpoint;
-
-      diff = (nextpoint->second - intpoint->second)/
-        (2*(nextpoint->first - intpoint->first))
-        +
-        (intpoint->second - lastpoint->second) /
-        (2*(intpoint->first - lastpoint->first));
-
-      ddata[intpoint->first] = diff ;
-    }
+      ddata[i] = (fdata[i + 1] - fdata[i]) / (2*(xdata[i + 1] - xdata[i]))
+               + (fdata[i] - fdata[i - 1]) / (2*(xdata[i] - xdata[i - 1]));
   }
 }
 
@@ -672,40 +675,29 @@ computeSimpleDerivatives() const {
 
 void
 MonotCubicInterpolator::
-adjustDerivativesForMonotoneness() const {
-  map<double,double>::const_iterator point, dpoint;
+adjustDerivativesForMonotoneness() {
 
   /* Loop over all intervals, ie. loop over all points and look
      at the interval to the right of the point */
-  for (point = data.begin(), dpoint = ddata.begin();
-       point != --data.end();
-       ++point, ++dpoint) {
-    map<double,double>::const_iterator nextpoint, nextdpoint;
-    nextpoint = point; ++nextpoint;
-    nextdpoint = dpoint; ++nextdpoint;
-
+  for (size_t i = 0; i + 1 < xdata.size(); ++i) {
     double delta =
-      (nextpoint->second - point->second) /
-      (nextpoint->first  - point->first);
+      (fdata[i + 1] - fdata[i]) /
+      (xdata[i + 1] - xdata[i]);
     if (fabs(delta) < 1e-14) {
-      ddata[point->first] = 0.0;
-      ddata[nextpoint->first] = 0.0;
+      ddata[i] = 0.0;
+      ddata[i + 1] = 0.0;
     } else {
-      double alpha = ddata[point->first] / delta;
-      double beta = ddata[nextpoint->first] / delta;
+      double alpha = ddata[i] / delta;
+      double beta = ddata[i + 1] / delta;
 
       if (! isMonotoneCoeff(alpha, beta)) {
         double tau = 3/sqrt(alpha*alpha + beta*beta);
 
-        ddata[point->first]     = tau*alpha*delta;
-        ddata[nextpoint->first] = tau*beta*delta;
+        ddata[i]     = tau*alpha*delta;
+        ddata[i + 1] = tau*beta*delta;
       }
     }
-
-
   }
-
-
 }
 
 
@@ -714,17 +706,15 @@ adjustDerivativesForMonotoneness() const {
 void
 MonotCubicInterpolator::
 scaleData(double factor) {
-  map<double,double>::iterator it , itd  ;
-  if (data.size() == ddata.size()) {
-    for (it = data.begin() , itd = ddata.begin() ; it != data.end() ; ++it , ++itd) {
-      it->second  *= factor ;
-      itd->second *= factor ;
-    } ;
-  } else {
-    for (it = data.begin() ; it != data.end() ; ++it ) {
-      it->second  *= factor ;
-    }
+  for (double& f : fdata) {
+    f *= factor;
+  }
+  for (double& d : ddata) {
+    d *= factor;
   }
+
+  // The direction of monotonicity flips with a negative factor:
+  computeMonotoneness();
 }
 
 
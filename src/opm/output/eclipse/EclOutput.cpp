@@ -0,0 +1,410 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <opm/output/eclipse/EclOutput.hpp>
+
+namespace Opm { namespace out {
+
+namespace {
+
+    const size_t numeric_block_size = 1000;
+    const size_t char_block_size    = 105;
+    const size_t char_length        = 8;
+    const size_t header_size        = 16;
+    const size_t min_buffer_size    = 64 * 1024;
+    const size_t max_range_records  = 1024;
+
+    inline void store_be32( char* dst, std::uint32_t value ) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        value = __builtin_bswap32( value );
+        std::memcpy( dst, &value, sizeof( value ) );
+#else
+        dst[ 0 ] = char( value >> 24 );
+        dst[ 1 ] = char( value >> 16 );
+        dst[ 2 ] = char( value >> 8 );
+        dst[ 3 ] = char( value );
+#endif
+    }
+
+    inline void store_be64( char* dst, std::uint64_t value ) {
+        store_be32( dst, std::uint32_t( value >> 32 ) );
+        store_be32( dst + 4, std::uint32_t( value ) );
+    }
+
+    inline void store_string( char* dst, const std::string& value, size_t length ) {
+        const auto size = std::min( value.size(), length );
+        std::memcpy( dst, value.data(), size );
+        std::memset( dst + size, ' ', length - size );
+    }
+
+#ifdef __SSE2__
+    /* Reverses the bytes of every 32 bit (swap32) or 64 bit (swap64) lane. */
+    inline __m128i swap32( __m128i value ) {
+        value = _mm_or_si128( _mm_slli_epi16( value, 8 ), _mm_srli_epi16( value, 8 ) );
+        value = _mm_shufflelo_epi16( value, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+        return _mm_shufflehi_epi16( value, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+    }
+
+    inline __m128i swap64( __m128i value ) {
+        value = _mm_or_si128( _mm_slli_epi16( value, 8 ), _mm_srli_epi16( value, 8 ) );
+        value = _mm_shufflelo_epi16( value, _MM_SHUFFLE( 0, 1, 2, 3 ) );
+        return _mm_shufflehi_epi16( value, _MM_SHUFFLE( 0, 1, 2, 3 ) );
+    }
+#endif
+
+    /*
+      The encode functions write n elements from src to dst as big
+      endian 32 bit (int, float) or 64 bit (double) values.
+    */
+
+    void encode32( const void* src, size_t n, char* dst ) {
+        const char* bytes = static_cast< const char* >( src );
+        size_t i = 0;
+#ifdef __SSE2__
+        for( ; i + 4 <= n; i += 4 ) {
+            const auto value = _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes + 4 * i ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i* >( dst + 4 * i ), swap32( value ) );
+        }
+#endif
+        for( ; i < n; ++i ) {
+            std::uint32_t value;
+            std::memcpy( &value, bytes + 4 * i, sizeof( value ) );
+            store_be32( dst + 4 * i, value );
+        }
+    }
+
+    void encode64( const double* src, size_t n, char* dst ) {
+        size_t i = 0;
+#ifdef __SSE2__
+        for( ; i + 2 <= n; i += 2 ) {
+            const auto value = _mm_loadu_si128( reinterpret_cast< const __m128i* >( src + i ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i* >( dst + 8 * i ), swap64( value ) );
+        }
+#endif
+        for( ; i < n; ++i ) {
+            std::uint64_t value;
+            std::memcpy( &value, src + i, sizeof( value ) );
+            store_be64( dst + 8 * i, value );
+        }
+    }
+
+    void encode_float( const double* src, size_t n, char* dst ) {
+        size_t i = 0;
+#ifdef __SSE2__
+        for( ; i + 4 <= n; i += 4 ) {
+            const auto lo = _mm_cvtpd_ps( _mm_loadu_pd( src + i ) );
+            const auto hi = _mm_cvtpd_ps( _mm_loadu_pd( src + i + 2 ) );
+            const auto value = _mm_castps_si128( _mm_movelh_ps( lo, hi ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i* >( dst + 4 * i ), swap32( value ) );
+        }
+#endif
+        for( ; i < n; ++i ) {
+            const float value = static_cast< float >( src[ i ] );
+            std::uint32_t bits;
+            std::memcpy( &bits, &value, sizeof( bits ) );
+            store_be32( dst + 4 * i, bits );
+        }
+    }
+
+    void check_name( const std::string& name ) {
+        if( name.size() > char_length )
+            throw std::invalid_argument( "Keyword name " + name + " is longer than 8 characters" );
+    }
+
+    /* Encodes the header record, markers included, of a keyword. */
+    void encode_header( char* dst, const std::string& name, size_t count, const char* type ) {
+        store_be32( dst, header_size );
+        store_string( dst + 4, name, char_length );
+        store_be32( dst + 12, static_cast< std::uint32_t >( count ) );
+        std::memcpy( dst + 16, type, 4 );
+        store_be32( dst + 20, header_size );
+    }
+
+}
+
+EclOutput::EclOutput( const std::string& filename_arg,
+                      bool append,
+                      size_t buffer_size ) :
+    m_filename( filename_arg ),
+    stream( filename_arg, std::ios::binary | ( append ? std::ios::app : std::ios::trunc ) ),
+    buffer( std::max( buffer_size, min_buffer_size ) )
+{
+    if( !this->stream )
+        throw std::runtime_error( "Could not open file " + filename_arg + " for writing" );
+}
+
+EclOutput::~EclOutput() {
+    try {
+        if( this->stream.is_open() )
+            this->writeBuffer();
+    } catch( ... ) {}
+}
+
+const std::string& EclOutput::filename() const {
+    return this->m_filename;
+}
+
+char* EclOutput::reserve( size_t size ) {
+    if( this->used + size > this->buffer.size() )
+        this->writeBuffer();
+
+    auto* dst = this->buffer.data() + this->used;
+    this->used += size;
+    return dst;
+}
+
+void EclOutput::writeBuffer() {
+    this->stream.write( this->buffer.data(), this->used );
+    this->used = 0;
+
+    if( !this->stream )
+        throw std::runtime_error( "Writing file " + this->m_filename + " failed" );
+}
+
+void EclOutput::flush() {
+    this->writeBuffer();
+    this->stream.flush();
+
+    if( !this->stream )
+        throw std::runtime_error( "Writing file " + this->m_filename + " failed" );
+}
+
+void EclOutput::close() {
+    this->flush();
+    this->stream.close();
+}
+
+void EclOutput::writeHeader( const std::string& name, size_t count, const char* type ) {
+    check_name( name );
+    encode_header( this->reserve( header_size + 8 ), name, count, type );
+}
+
+template< typename Encode >
+void EclOutput::writeArray( const std::string& name, const char* type, size_t count,
+                            size_t element_size, size_t block_size, Encode encode ) {
+    this->writeHeader( name, count, type );
+
+    for( size_t start = 0; start < count; start += block_size ) {
+        const auto n = std::min( block_size, count - start );
+        const auto bytes = static_cast< std::uint32_t >( n * element_size );
+
+        auto* dst = this->reserve( bytes + 8 );
+        store_be32( dst, bytes );
+        encode( start, n, dst + 4 );
+        store_be32( dst + 4 + bytes, bytes );
+    }
+}
+
+void EclOutput::write( const std::string& name, const std::vector< int >& data ) {
+    this->writeArray( name, "INTE", data.size(), 4, numeric_block_size,
+                      [&data]( size_t start, size_t n, char* dst ) {
+                          encode32( data.data() + start, n, dst );
+                      });
+}
+
+void EclOutput::write( const std::string& name, const std::vector< float >& data ) {
+    this->writeArray( name, "REAL", data.size(), 4, numeric_block_size,
+                      [&data]( size_t start, size_t n, char* dst ) {
+                          encode32( data.data() + start, n, dst );
+                      });
+}
+
+void EclOutput::write( const std::string& name, const std::vector< double >& data ) {
+    this->writeArray( name, "DOUB", data.size(), 8, numeric_block_size,
+                      [&data]( size_t start, size_t n, char* dst ) {
+                          encode64( data.data() + start, n, dst );
+                      });
+}
+
+void EclOutput::write( const std::string& name, const std::vector< std::string >& data ) {
+    this->writeArray( name, "CHAR", data.size(), char_length, char_block_size,
+                      [&data]( size_t start, size_t n, char* dst ) {
+                          for( size_t i = 0; i < n; ++i )
+                              store_string( dst + char_length * i, data[ start + i ], char_length );
+                      });
+}
+
+void EclOutput::writeFloat( const std::string& name, const std::vector< double >& data ) {
+    this->writeArray( name, "REAL", data.size(), 4, numeric_block_size,
+                      [&data]( size_t start, size_t n, char* dst ) {
+                          encode_float( data.data() + start, n, dst );
+                      });
+}
+
+void EclOutput::writeFromSI( const std::string& name,
+                             const std::vector< double >& data,
+                             const UnitSystem& units,
+                             UnitSystem::measure dim,
+                             bool write_double ) {
+    if( dim == UnitSystem::measure::identity ) {
+        if( write_double )
+            this->write( name, data );
+        else
+            this->writeFloat( name, data );
+
+        return;
+    }
+
+    auto& block = this->scratch;
+    const auto convert = [&]( size_t start, size_t n ) {
+        block.assign( data.begin() + start, data.begin() + start + n );
+        units.from_si( dim, block );
+    };
+
+    if( write_double )
+        this->writeArray( name, "DOUB", data.size(), 8, numeric_block_size,
+                          [&]( size_t start, size_t n, char* dst ) {
+                              convert( start, n );
+                              encode64( block.data(), n, dst );
+                          });
+    else
+        this->writeArray( name, "REAL", data.size(), 4, numeric_block_size,
+                          [&]( size_t start, size_t n, char* dst ) {
+                              convert( start, n );
+                              encode_float( block.data(), n, dst );
+                          });
+}
+
+void EclOutput::message( const std::string& name ) {
+    this->writeHeader( name, 0, "MESS" );
+}
+
+
+
+EclPositionedOutput::EclPositionedOutput( const std::string& filename_arg ) :
+    m_filename( filename_arg ),
+    fd( ::open( filename_arg.c_str(), O_WRONLY | O_CREAT, 0666 ) )
+{
+    if( this->fd < 0 )
+        throw std::runtime_error( "Could not open file " + filename_arg + " for writing" );
+}
+
+EclPositionedOutput::~EclPositionedOutput() {
+    ::close( this->fd );
+}
+
+std::uint64_t EclPositionedOutput::keywordSize( size_t count, bool write_double ) {
+    const size_t records = ( count + numeric_block_size - 1 ) / numeric_block_size;
+    return header_size + 8 + std::uint64_t( count ) * ( write_double ? 8 : 4 ) + 8 * records;
+}
+
+void EclPositionedOutput::pwrite( std::uint64_t offset, const char* data, size_t size ) {
+    while( size > 0 ) {
+        const auto n = ::pwrite( this->fd, data, size, offset );
+        if( n <= 0 )
+            throw std::runtime_error( "Writing file " + this->m_filename + " failed" );
+
+        data += n;
+        offset += n;
+        size -= n;
+    }
+}
+
+void EclPositionedOutput::resize( std::uint64_t size ) {
+    if( ::ftruncate( this->fd, size ) != 0 )
+        throw std::runtime_error( "Resizing file " + this->m_filename + " failed" );
+}
+
+void EclPositionedOutput::writeHeader( std::uint64_t offset, const std::string& name,
+                                       size_t count, bool write_double ) {
+    char header[ header_size + 8 ];
+    check_name( name );
+    encode_header( header, name, count, write_double ? "DOUB" : "REAL" );
+    this->pwrite( offset, header, sizeof( header ) );
+}
+
+void EclPositionedOutput::message( std::uint64_t offset, const std::string& name ) {
+    char header[ header_size + 8 ];
+    check_name( name );
+    encode_header( header, name, 0, "MESS" );
+    this->pwrite( offset, header, sizeof( header ) );
+}
+
+/*
+  The range is written in pieces of at most max_range_records records;
+  each piece is encoded into the buffer - values and the record markers
+  which belong to it - and written with one pwrite().
+*/
+void EclPositionedOutput::writeRange( std::uint64_t offset,
+                                      size_t count,
+                                      size_t first,
+                                      const double* values,
+                                      size_t n,
+                                      bool write_double ) {
+    if( first + n > count )
+        throw std::out_of_range( "Range is outside of the keyword" );
+
+    const size_t element_size = write_double ? 8 : 4;
+    const size_t record_stride = numeric_block_size * element_size + 8;
+    const auto data_offset = offset + header_size + 8;
+    const auto position = [&]( size_t index ) {
+        return data_offset + ( index / numeric_block_size ) * record_stride
+                           + 4 + ( index % numeric_block_size ) * element_size;
+    };
+
+    const size_t end = first + n;
+    size_t piece_first = first;
+    while( piece_first < end ) {
+        const size_t piece_end = std::min( end, ( piece_first / numeric_block_size + max_range_records ) * numeric_block_size );
+        const auto begin_pos = position( piece_first ) - ( piece_first % numeric_block_size == 0 ? 4 : 0 );
+        const auto end_pos = position( piece_end - 1 ) + element_size;
+
+        this->buffer.resize( end_pos - begin_pos + 4 );
+        char* dst = this->buffer.data();
+        for( size_t start = piece_first; start < piece_end; ) {
+            const size_t record = start / numeric_block_size;
+            const size_t record_start = record * numeric_block_size;
+            const size_t record_size = std::min( numeric_block_size, count - record_start );
+            const size_t stop = std::min( piece_end, record_start + record_size );
+            const auto bytes = static_cast< std::uint32_t >( record_size * element_size );
+            char* values_dst = dst + ( position( start ) - begin_pos );
+
+            if( start == record_start )
+                store_be32( values_dst - 4, bytes );
+
+            if( write_double )
+                encode64( values + ( start - first ), stop - start, values_dst );
+            else
+                encode_float( values + ( start - first ), stop - start, values_dst );
+
+            if( stop == record_start + record_size )
+                store_be32( values_dst + ( stop - start ) * element_size, bytes );
+
+            start = stop;
+        }
+
+        const bool last_in_record = ( piece_end % numeric_block_size == 0 ) || piece_end == count;
+        this->pwrite( begin_pos, this->buffer.data(), end_pos - begin_pos + ( last_in_record ? 4 : 0 ) );
+        piece_first = piece_end;
+    }
+}
+
+}}
@@ -25,6 +25,9 @@
 #include "config.h"
 
 #include <opm/output/eclipse/EclipseIO.hpp>
+#include <opm/output/eclipse/EclOutput.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
 
 #include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/parser/eclipse/Units/Dimension.hpp>
@@ -42,8 +45,15 @@
 #include <opm/output/eclipse/Tables.hpp>
 #include <opm/output/eclipse/RestartIO.hpp>
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstdlib>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <memory>     // unique_ptr
+#include <mutex>
+#include <thread>
 #include <utility>    // move
 
 #include <ert/ecl/EclKW.hpp>
@@ -92,6 +102,18 @@ void writeKeyword( ERT::FortIO& fortio ,
 
 }
 
+void writeKeyword( out::EclOutput& output ,
+                   const std::string& keywordName,
+                   const std::vector<int> &data ) {
+    output.write( keywordName, data );
+}
+
+void writeKeyword( out::EclOutput& output ,
+                   const std::string& keywordName,
+                   const std::vector<double> &data) {
+    output.writeFloat( keywordName, data );
+}
+
 
 
 
@@ -198,6 +220,109 @@ inline std::string uppercase( std::string x ) {
     return x;
 }
 
+/*
+  The OutputThread runs the queued output jobs one at a time, in the order
+  they were pushed. push() blocks while max_queued jobs are waiting. The
+  exception of a failed job discards the remaining queued jobs, and is
+  rethrown from the next push() or barrier().
+*/
+class OutputThread {
+    public:
+        explicit OutputThread( size_t max_queued_arg ) :
+            max_queued( std::max< size_t >( 1, max_queued_arg ) ),
+            thread( &OutputThread::run, this )
+        {}
+
+        ~OutputThread() {
+            {
+                std::lock_guard< std::mutex > lock( this->mutex );
+                this->stop = true;
+            }
+            this->changed.notify_all();
+            this->thread.join();
+
+            if( this->error ) {
+                try {
+                    std::rethrow_exception( this->error );
+                } catch( const std::exception& e ) {
+                    OpmLog::error( std::string( "Asynchronous output failed: " ) + e.what() );
+                } catch( ... ) {
+                    OpmLog::error( "Asynchronous output failed" );
+                }
+            }
+        }
+
+        void push( std::function< void() > job ) {
+            std::unique_lock< std::mutex > lock( this->mutex );
+            this->changed.wait( lock, [this] {
+                return this->error || this->jobs.size() < this->max_queued;
+            });
+            this->rethrow();
+
+            this->jobs.push_back( std::move( job ) );
+            this->changed.notify_all();
+        }
+
+        void barrier() {
+            std::unique_lock< std::mutex > lock( this->mutex );
+            this->changed.wait( lock, [this] {
+                return this->jobs.empty() && !this->busy;
+            });
+            this->rethrow();
+        }
+
+    private:
+        void rethrow() {
+            if( !this->error )
+                return;
+
+            auto e = this->error;
+            this->error = nullptr;
+            std::rethrow_exception( e );
+        }
+
+        void run() {
+            std::unique_lock< std::mutex > lock( this->mutex );
+            while( true ) {
+                this->changed.wait( lock, [this] {
+                    return this->stop || !this->jobs.empty();
+                });
+                if( this->jobs.empty() )
+                    return;
+
+                auto job = std::move( this->jobs.front() );
+                this->jobs.pop_front();
+                this->busy = true;
+                this->changed.notify_all();
+                lock.unlock();
+
+                std::exception_ptr job_error;
+                try {
+                    job();
+                } catch( ... ) {
+                    job_error = std::current_exception();
+                }
+
+                lock.lock();
+                this->busy = false;
+                if( job_error ) {
+                    this->error = job_error;
+                    this->jobs.clear();
+                }
+                this->changed.notify_all();
+            }
+        }
+
+        size_t max_queued;
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::deque< std::function< void() > > jobs;
+        bool busy = false;
+        bool stop = false;
+        std::exception_ptr error;
+        std::thread thread;
+};
+
 }
 
 class EclipseIO::Impl {
@@ -205,6 +330,19 @@ class EclipseIO::Impl {
     Impl( const EclipseState&, EclipseGrid, const Schedule&, const SummaryConfig& );
         void writeINITFile( const data::Solution& simProps, std::map<std::string, std::vector<int> > int_data, const NNC& nnc) const;
         void writeEGRIDFile( const NNC& nnc ) const;
+        template< typename Output >
+        void writeINITProperties( Output& output,
+                                  const data::Solution& simProps,
+                                  const std::map<std::string, std::vector<int> >& int_data,
+                                  const NNC& nnc) const;
+        void writeTimeStep( int report_step,
+                            bool isSubstep,
+                            double secs_elapsed,
+                            const RestartValue& value,
+                            const std::map<std::string, double>& single_summary_values,
+                            const std::map<std::string, std::vector<double> >& region_summary_values,
+                            const std::map<std::pair<std::string, int>, double>& block_summary_values,
+                            bool write_double);
 
         const EclipseState& es;
         EclipseGrid grid;
@@ -214,6 +352,10 @@ class EclipseIO::Impl {
         out::Summary summary;
         RFT rft;
         bool output_enabled;
+
+        // Declared last, so the queued steps are written before the
+        // members above are destroyed.
+        std::unique_ptr< OutputThread > output_thread;
 };
 
 EclipseIO::Impl::Impl( const EclipseState& eclipseState,
@@ -277,6 +419,28 @@ void EclipseIO::Impl::writeINITFile( const data::Solution& simProps, std::map<st
     ecl_grid_fwrite_depth( this->grid.c_ptr() , fortio.get() , units.getEclType( ) );
     ecl_grid_fwrite_dims( this->grid.c_ptr() , fortio.get() , units.getEclType( ) );
 
+    /*
+      The remaining keywords of unformatted files are appended with the
+      buffered EclOutput writer.
+    */
+    if (ioConfig.getFMTOUT())
+        this->writeINITProperties( fortio, simProps, int_data, nnc );
+    else {
+        fortio.close();
+        out::EclOutput output( initFile, true );
+        this->writeINITProperties( output, simProps, int_data, nnc );
+        output.close();
+    }
+}
+
+
+template< typename Output >
+void EclipseIO::Impl::writeINITProperties( Output& output,
+                                           const data::Solution& simProps,
+                                           const std::map<std::string, std::vector<int> >& int_data,
+                                           const NNC& nnc) const {
+    const auto& units = this->es.getUnits();
+
     // Write properties from the input deck.
     {
         const auto& properties = this->es.get3DProperties().getDoubleProperties();
@@ -303,7 +467,7 @@ void EclipseIO::Impl::writeINITFile( const data::Solution& simProps, std::map<st
                 auto ecl_data = opm_property.compressedCopy( this->grid );
 
                 units.from_si( kw_pair.second, ecl_data );
-                writeKeyword( fortio, kw_pair.first, ecl_data );
+                writeKeyword( output, kw_pair.first, ecl_data );
             }
         }
     }
@@ -313,7 +477,7 @@ void EclipseIO::Impl::writeINITFile( const data::Solution& simProps, std::map<st
     {
         for (const auto& prop : simProps) {
             auto ecl_data = this->grid.compressedVector( prop.second.data );
-            writeKeyword( fortio, prop.first, ecl_data );
+            writeKeyword( output, prop.first, ecl_data );
         }
     }
 
@@ -325,7 +489,7 @@ void EclipseIO::Impl::writeINITFile( const data::Solution& simProps, std::map<st
         tables.addPVTW( this->es.getTableManager().getPvtwTable() );
         tables.addDensity( this->es.getTableManager().getDensityTable( ) );
         tables.addSatFunc(this->es);
-        fwrite(tables, fortio);
+        fwrite(tables, output);
     }
 
     // Write all integer field properties from the input deck.
@@ -343,7 +507,7 @@ void EclipseIO::Impl::writeINITFile( const data::Solution& simProps, std::map<st
 
         for (const auto& property : properties) {
             auto ecl_data = property.compressedCopy( this->grid );
-            writeKeyword( fortio , property.getKeywordName() , ecl_data );
+            writeKeyword( output , property.getKeywordName() , ecl_data );
         }
     }
 
@@ -356,7 +520,7 @@ void EclipseIO::Impl::writeINITFile( const data::Solution& simProps, std::map<st
             if (key.size() > ECL_STRING8_LENGTH)
               throw std::invalid_argument("Keyword is too long.");            
 
-            writeKeyword( fortio , key , int_vector );
+            writeKeyword( output , key , int_vector );
         }
     }
 
@@ -368,7 +532,7 @@ void EclipseIO::Impl::writeINITFile( const data::Solution& simProps, std::map<st
             tran.push_back( nd.trans );
 
         units.from_si( UnitSystem::measure::transmissibility , tran );
-        writeKeyword( fortio, "TRANNNC" , tran );
+        writeKeyword( output, "TRANNNC" , tran );
     }
 }
 
@@ -428,10 +592,44 @@ void EclipseIO::writeTimeStep(int report_step,
     if( !this->impl->output_enabled )
         return;
 
+    if( this->impl->output_thread ) {
+        auto* impl_ptr = this->impl.get();
+        this->impl->output_thread->push( [=, value = std::move( value )]() {
+            impl_ptr->writeTimeStep( report_step,
+                                     isSubstep,
+                                     secs_elapsed,
+                                     value,
+                                     single_summary_values,
+                                     region_summary_values,
+                                     block_summary_values,
+                                     write_double );
+        });
+        return;
+    }
 
-    const auto& es = this->impl->es;
-    const auto& grid = this->impl->grid;
-    const auto& schedule = this->impl->schedule;
+    this->impl->writeTimeStep( report_step,
+                               isSubstep,
+                               secs_elapsed,
+                               value,
+                               single_summary_values,
+                               region_summary_values,
+                               block_summary_values,
+                               write_double );
+}
+
+
+void EclipseIO::Impl::writeTimeStep(int report_step,
+                                    bool  isSubstep,
+                                    double secs_elapsed,
+                                    const RestartValue& value,
+                                    const std::map<std::string, double>& single_summary_values,
+                                    const std::map<std::string, std::vector<double> >& region_summary_values,
+                                    const std::map<std::pair<std::string, int>, double>& block_summary_values,
+                                    bool write_double)
+ {
+    const auto& es = this->es;
+    const auto& grid = this->grid;
+    const auto& schedule = this->schedule;
     const auto& units = es.getUnits();
     const auto& ioConfig = es.getIOConfig();
     const auto& restart = es.cfg().restart();
@@ -442,15 +640,15 @@ void EclipseIO::writeTimeStep(int report_step,
       Summary data is written unconditionally for every timestep.
     */
     {
-        this->impl->summary.add_timestep( report_step,
-                                          secs_elapsed,
-                                          es,
-                                          schedule,
-                                          value.wells ,
-                                          single_summary_values ,
-                                          region_summary_values,
-                                          block_summary_values);
-        this->impl->summary.write();
+        this->summary.add_timestep( report_step,
+                                    secs_elapsed,
+                                    es,
+                                    schedule,
+                                    value.wells ,
+                                    single_summary_values ,
+                                    region_summary_values,
+                                    block_summary_values);
+        this->summary.write();
     }
 
 
@@ -461,8 +659,8 @@ void EclipseIO::writeTimeStep(int report_step,
     */
     if(!isSubstep && restart.getWriteRestartFile(report_step))
     {
-        std::string filename = ERT::EclFilename( this->impl->outputDir,
-                                                 this->impl->baseName,
+        std::string filename = ERT::EclFilename( this->outputDir,
+                                                 this->baseName,
                                                  ioConfig.getUNIFOUT() ? ECL_UNIFIED_RESTART_FILE : ECL_RESTART_FILE,
                                                  report_step,
                                                  ioConfig.getFMTOUT() );
@@ -478,16 +676,16 @@ void EclipseIO::writeTimeStep(int report_step,
         return;
 
     {
-        std::vector<const Well*> sched_wells = this->impl->schedule.getWells( report_step );
+        const auto& sched_wells = this->schedule.getWells( report_step );
         const auto rft_active = [report_step] (const Well* w) { return w->getRFTActive( report_step ) || w->getPLTActive( report_step ); };
         if (std::any_of(sched_wells.begin(), sched_wells.end(), rft_active)) {
-            this->impl->rft.writeTimeStep( sched_wells,
-                                           grid,
-                                           report_step,
-                                           secs_elapsed + this->impl->schedule.posixStartTime(),
-                                           units.from_si( UnitSystem::measure::time, secs_elapsed ),
-                                           units,
-                                           value.wells );
+            this->rft.writeTimeStep( sched_wells,
+                                     grid,
+                                     report_step,
+                                     secs_elapsed + this->schedule.posixStartTime(),
+                                     units.from_si( UnitSystem::measure::time, secs_elapsed ),
+                                     units,
+                                     value.wells );
         }
     }
 
@@ -495,6 +693,21 @@ void EclipseIO::writeTimeStep(int report_step,
 
 
 
+void EclipseIO::enableAsyncOutput( size_t max_queued_steps ) {
+    if( !this->impl->output_enabled )
+        return;
+
+    this->flush();
+    this->impl->output_thread.reset( new OutputThread( max_queued_steps ) );
+}
+
+
+void EclipseIO::flush() {
+    if( this->impl->output_thread )
+        this->impl->output_thread->barrier();
+}
+
+
 RestartValue EclipseIO::loadRestart(const std::vector<RestartKey>& solution_keys, const std::vector<RestartKey>& extra_keys) const {
     const auto& es                       = this->impl->es;
     const auto& grid                     = this->impl->grid;
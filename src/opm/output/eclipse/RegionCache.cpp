@@ -16,8 +16,12 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <algorithm>
+#include <numeric>
+
 #include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/TimeMap.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/WellConnections.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Connection.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Well.hpp>
@@ -30,31 +34,104 @@
 namespace Opm {
 namespace out {
 
+    RegionCache::Range::Range( const Connection* first_arg, const Connection* last_arg ) :
+        first( first_arg ),
+        last( last_arg )
+    {}
+
+    const RegionCache::Connection* RegionCache::Range::begin() const {
+        return this->first;
+    }
+
+    const RegionCache::Connection* RegionCache::Range::end() const {
+        return this->last;
+    }
+
+    size_t RegionCache::Range::size() const {
+        return this->last - this->first;
+    }
+
+    bool RegionCache::Range::empty() const {
+        return this->first == this->last;
+    }
+
+    const RegionCache::Connection& RegionCache::Range::operator[]( size_t index ) const {
+        return this->first[ index ];
+    }
+
+
 RegionCache::RegionCache(const Eclipse3DProperties& properties, const EclipseGrid& grid, const Schedule& schedule) {
     const auto& fipnum = properties.getIntGridProperty("FIPNUM");
+    const auto& fipnum_data = fipnum.getData();
+    const int max_region = fipnum_data.empty() ? 0 : std::max( 0, *std::max_element( fipnum_data.begin(), fipnum_data.end() ) );
 
     const auto& wells = schedule.getWells();
-    for (const auto& well : wells) {
-        const auto& connections = well->getConnections( );
-        for (const auto& c : connections) {
-            size_t global_index = grid.getGlobalIndex( c.getI() , c.getJ() , c.getK());
-            if (grid.cellActive( global_index )) {
-                size_t active_index = grid.activeIndex( global_index );
-                int region_id =fipnum.iget( global_index );
-                auto& well_index_list = this->connection_map[ region_id ];
-                well_index_list.push_back( { well->name() , active_index } );
+    const size_t num_steps = schedule.getTimeMap().size();
+
+    /*
+      The WellConnections of a well are shared between the report steps
+      where they do not change, so a new snapshot is only built at the
+      report steps where the connections object of some well differs
+      from the previous step.
+    */
+    std::vector< const WellConnections* > current( wells.size(), nullptr );
+    std::vector< std::pair< int, Connection > > region_connections;
+    for (size_t step = 0; step < num_steps; ++step) {
+        bool changed = this->snapshots.empty();
+        for (size_t well = 0; well < wells.size(); ++well) {
+            const auto* connections = &wells[ well ]->getConnections( step );
+            if (connections != current[ well ]) {
+                current[ well ] = connections;
+                changed = true;
+            }
+        }
+
+        if (!changed)
+            continue;
+
+        region_connections.clear();
+        for (size_t well = 0; well < wells.size(); ++well) {
+            const auto& connections = *current[ well ];
+            for (size_t index = 0; index < connections.size(); ++index) {
+                const auto& c = connections.get( index );
+                size_t global_index = grid.getGlobalIndex( c.getI() , c.getJ() , c.getK());
+                if (grid.cellActive( global_index )) {
+                    int region_id = fipnum.iget( global_index );
+                    if (region_id >= 0)
+                        region_connections.push_back( { region_id, { well, index, grid.activeIndex( global_index ) } } );
+                }
             }
         }
+
+        Snapshot snapshot;
+        snapshot.offsets.assign( max_region + 2, 0 );
+        for (const auto& rc : region_connections)
+            snapshot.offsets[ rc.first + 1 ] += 1;
+
+        std::partial_sum( snapshot.offsets.begin(), snapshot.offsets.end(), snapshot.offsets.begin() );
+
+        auto next = snapshot.offsets;
+        snapshot.connections.resize( region_connections.size() );
+        for (const auto& rc : region_connections)
+            snapshot.connections[ next[ rc.first ]++ ] = rc.second;
+
+        this->first_step.push_back( step );
+        this->snapshots.push_back( std::move( snapshot ) );
     }
 }
 
 
-    const std::vector<std::pair<std::string,size_t>>& RegionCache::connections( int region_id ) const {
-        const auto iter = this->connection_map.find( region_id );
-        if (iter == this->connection_map.end())
-            return this->connections_empty;
-        else
-            return iter->second;
+    RegionCache::Range RegionCache::connections( int region_id, size_t timeStep ) const {
+        if (this->snapshots.empty() || region_id < 0)
+            return { nullptr, nullptr };
+
+        const auto iter = std::upper_bound( this->first_step.begin(), this->first_step.end(), timeStep );
+        const auto& snapshot = this->snapshots[ std::max< size_t >( 1, iter - this->first_step.begin() ) - 1 ];
+        if (static_cast< size_t >( region_id ) + 1 >= snapshot.offsets.size())
+            return { nullptr, nullptr };
+
+        const auto* data = snapshot.connections.data();
+        return { data + snapshot.offsets[ region_id ], data + snapshot.offsets[ region_id + 1 ] };
     }
 
 }
@@ -0,0 +1,508 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <opm/output/eclipse/RestartFile.hpp>
+
+namespace Opm { namespace RestartIO {
+
+namespace {
+
+    const size_t header_size              = 16;
+    const size_t char_length              = 8;
+    const size_t numeric_block_size       = 1000;
+    const size_t char_block_size          = 105;
+    const size_t min_elements_per_thread  = 256 * 1024;
+
+    const char index_magic[ 8 ]       = { 'O', 'P', 'M', 'R', 'S', 'T', 'I', 'X' };
+    const std::uint64_t index_version = 1;
+
+    inline std::uint32_t load_be32( const char* src ) {
+        std::uint32_t value;
+        std::memcpy( &value, src, sizeof( value ) );
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        return __builtin_bswap32( value );
+#else
+        const auto* bytes = reinterpret_cast< const unsigned char* >( src );
+        return ( std::uint32_t( bytes[ 0 ] ) << 24 ) | ( std::uint32_t( bytes[ 1 ] ) << 16 )
+             | ( std::uint32_t( bytes[ 2 ] ) << 8 ) | std::uint32_t( bytes[ 3 ] );
+#endif
+    }
+
+    inline std::uint64_t load_be64( const char* src ) {
+        return ( std::uint64_t( load_be32( src ) ) << 32 ) | load_be32( src + 4 );
+    }
+
+    std::string trim( const char* src, size_t length ) {
+        std::string value( src, length );
+        return value.erase( value.find_last_not_of( ' ' ) + 1 );
+    }
+
+    /* The element size and the number of elements per record of a keyword type. */
+    std::pair< size_t, size_t > element_layout( const std::string& type ) {
+        if( type == "INTE" || type == "REAL" || type == "LOGI" )
+            return { 4, numeric_block_size };
+
+        if( type == "DOUB" )
+            return { 8, numeric_block_size };
+
+        if( type == "CHAR" )
+            return { char_length, char_block_size };
+
+        if( type == "MESS" )
+            return { 0, numeric_block_size };
+
+        /* C0nn: strings of nn characters. */
+        if( type.size() == 4 && type[ 0 ] == 'C' && std::isdigit( type[ 1 ] )
+            && std::isdigit( type[ 2 ] ) && std::isdigit( type[ 3 ] ) )
+            return { std::stoul( type.substr( 1 ) ), char_block_size };
+
+        throw std::runtime_error( "Unknown keyword type " + type );
+    }
+
+    /* The number of bytes of the data records of a keyword. */
+    std::uint64_t data_size( const std::string& type, size_t size ) {
+        const auto layout = element_layout( type );
+        if( layout.first == 0 || size == 0 )
+            return 0;
+
+        const auto records = ( size + layout.second - 1 ) / layout.second;
+        return std::uint64_t( size ) * layout.first + 8 * records;
+    }
+
+    void read_at( int fd, std::uint64_t offset, size_t size, char* dst ) {
+        while( size > 0 ) {
+            const auto n = ::pread( fd, dst, size, offset );
+            if( n <= 0 )
+                throw std::runtime_error( "Reading restart file failed" );
+
+            dst += n;
+            offset += n;
+            size -= n;
+        }
+    }
+
+    /* A read only mapping of a range of a file. */
+    class Mapping {
+        public:
+            Mapping( int fd, std::uint64_t offset, size_t size ) {
+                const std::uint64_t page_size = ::sysconf( _SC_PAGESIZE );
+                const auto start = offset - offset % page_size;
+                this->length = size + ( offset - start );
+
+                this->addr = ::mmap( nullptr, this->length, PROT_READ, MAP_PRIVATE, fd, start );
+                if( this->addr == MAP_FAILED )
+                    throw std::runtime_error( "Memory mapping restart file failed" );
+
+                ::madvise( this->addr, this->length, MADV_WILLNEED );
+                this->begin = static_cast< const char* >( this->addr ) + ( offset - start );
+            }
+
+            ~Mapping() {
+                ::munmap( this->addr, this->length );
+            }
+
+            Mapping( const Mapping& ) = delete;
+            Mapping& operator=( const Mapping& ) = delete;
+
+            const char* data() const {
+                return this->begin;
+            }
+
+        private:
+            void* addr;
+            size_t length;
+            const char* begin;
+    };
+
+    /*
+      Reads the REAL or DOUB keyword kw into data, converting to SI units
+      unless units is null. The records are split between the threads;
+      every thread converts one record at a time through a small scratch
+      vector, the same way UnitSystem::to_si() converts a whole vector.
+    */
+    void read_double( int fd,
+                      const RestartFile::Keyword& kw,
+                      const UnitSystem* units,
+                      UnitSystem::measure dim,
+                      size_t num_threads,
+                      std::vector< double >& data ) {
+        const bool is_double = kw.type == "DOUB";
+        if( !is_double && kw.type != "REAL" )
+            throw std::invalid_argument( "Restart keyword " + kw.name + " is not floating point" );
+
+        data.resize( kw.size );
+        if( kw.size == 0 )
+            return;
+
+        const Mapping mapping( fd, kw.offset, data_size( kw.type, kw.size ) );
+        const size_t element_size = is_double ? 8 : 4;
+        const size_t record_stride = numeric_block_size * element_size + 8;
+        const size_t records = ( kw.size + numeric_block_size - 1 ) / numeric_block_size;
+        const bool convert = units && dim != UnitSystem::measure::identity;
+
+        const auto read_records = [&]( size_t first, size_t last ) {
+            std::vector< double > block;
+            for( size_t record = first; record < last; ++record ) {
+                const size_t start = record * numeric_block_size;
+                const size_t n = std::min( numeric_block_size, kw.size - start );
+                const char* src = mapping.data() + record * record_stride + 4;
+                double* dst = convert ? ( block.resize( n ), block.data() ) : data.data() + start;
+
+                if( is_double )
+                    for( size_t i = 0; i < n; ++i ) {
+                        const auto bits = load_be64( src + 8 * i );
+                        std::memcpy( dst + i, &bits, sizeof( bits ) );
+                    }
+                else
+                    for( size_t i = 0; i < n; ++i ) {
+                        const auto bits = load_be32( src + 4 * i );
+                        float value;
+                        std::memcpy( &value, &bits, sizeof( value ) );
+                        dst[ i ] = value;
+                    }
+
+                if( convert ) {
+                    units->to_si( dim, block );
+                    std::copy( block.begin(), block.end(), data.begin() + start );
+                }
+            }
+        };
+
+        const size_t threads = std::max< size_t >( 1, std::min( num_threads, kw.size / min_elements_per_thread ) );
+        if( threads == 1 ) {
+            read_records( 0, records );
+            return;
+        }
+
+        std::vector< std::thread > workers;
+        std::vector< std::exception_ptr > errors( threads );
+        for( size_t t = 0; t < threads; ++t ) {
+            const auto first = records * t / threads;
+            const auto last = records * ( t + 1 ) / threads;
+            workers.emplace_back( [&, t, first, last]() {
+                try {
+                    read_records( first, last );
+                } catch( ... ) {
+                    errors[ t ] = std::current_exception();
+                }
+            });
+        }
+
+        for( auto& worker : workers )
+            worker.join();
+
+        for( const auto& error : errors )
+            if( error )
+                std::rethrow_exception( error );
+    }
+
+    template< typename T >
+    void write_value( std::ofstream& stream, T value ) {
+        stream.write( reinterpret_cast< const char* >( &value ), sizeof( value ) );
+    }
+
+    template< typename T >
+    bool read_value( std::ifstream& stream, T& value ) {
+        return bool( stream.read( reinterpret_cast< char* >( &value ), sizeof( value ) ) );
+    }
+
+}
+
+RestartFile::RestartFile( const std::string& filename_arg,
+                          bool use_index_file,
+                          size_t num_threads_arg ) :
+    m_filename( filename_arg ),
+    num_threads( num_threads_arg > 0 ? num_threads_arg
+                                     : std::max( 1U, std::thread::hardware_concurrency() ) )
+{
+    this->fd = ::open( filename_arg.c_str(), O_RDONLY );
+    if( this->fd < 0 )
+        throw std::runtime_error( "Restart file " + filename_arg + " not found!" );
+
+    struct stat st;
+    if( ::fstat( this->fd, &st ) != 0 ) {
+        ::close( this->fd );
+        throw std::runtime_error( "Could not stat restart file " + filename_arg );
+    }
+
+    this->file_size = st.st_size;
+#ifdef __APPLE__
+    this->mtime_ns = std::int64_t( st.st_mtimespec.tv_sec ) * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+    this->mtime_ns = std::int64_t( st.st_mtim.tv_sec ) * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+
+    try {
+        if( use_index_file && this->readIndexFile() )
+            return;
+
+        this->buildIndex();
+        if( use_index_file )
+            this->writeIndexFile();
+    } catch( ... ) {
+        ::close( this->fd );
+        throw;
+    }
+}
+
+RestartFile::~RestartFile() {
+    ::close( this->fd );
+}
+
+std::string RestartFile::indexFilename( const std::string& filename ) {
+    return filename + ".index";
+}
+
+const std::string& RestartFile::filename() const {
+    return this->m_filename;
+}
+
+void RestartFile::buildIndex() {
+    this->steps.clear();
+
+    char header[ header_size + 8 ];
+    std::uint64_t pos = 0;
+    while( pos < this->file_size ) {
+        if( pos + sizeof( header ) > this->file_size )
+            throw std::runtime_error( "Restart file " + this->m_filename + " is truncated" );
+
+        read_at( this->fd, pos, sizeof( header ), header );
+        if( load_be32( header ) != header_size || load_be32( header + 4 + header_size ) != header_size )
+            throw std::runtime_error( "Restart file " + this->m_filename
+                                      + " has an invalid keyword header at offset "
+                                      + std::to_string( pos ) );
+
+        Keyword kw;
+        kw.name = trim( header + 4, char_length );
+        kw.size = load_be32( header + 12 );
+        kw.type = std::string( header + 16, 4 );
+        kw.offset = pos + sizeof( header );
+
+        pos = kw.offset + data_size( kw.type, kw.size );
+        if( pos > this->file_size )
+            throw std::runtime_error( "Restart file " + this->m_filename + " is truncated" );
+
+        if( kw.name == "SEQNUM" ) {
+            if( kw.type != "INTE" || kw.size == 0 )
+                throw std::runtime_error( "Restart file " + this->m_filename + " has an invalid SEQNUM" );
+
+            char value[ 4 ];
+            read_at( this->fd, kw.offset + 4, sizeof( value ), value );
+            this->steps.push_back( { static_cast< std::int32_t >( load_be32( value ) ), {} } );
+        } else if( this->steps.empty() )
+            this->steps.push_back( { -1, {} } );
+
+        this->steps.back().keywords.push_back( kw );
+    }
+}
+
+bool RestartFile::readIndexFile() {
+    std::ifstream stream( indexFilename( this->m_filename ), std::ios::binary );
+    if( !stream )
+        return false;
+
+    char magic[ sizeof( index_magic ) ];
+    std::uint64_t version, size, num_steps;
+    std::int64_t mtime;
+    if( !stream.read( magic, sizeof( magic ) )
+        || std::memcmp( magic, index_magic, sizeof( magic ) ) != 0
+        || !read_value( stream, version ) || version != index_version
+        || !read_value( stream, size ) || size != this->file_size
+        || !read_value( stream, mtime ) || mtime != this->mtime_ns
+        || !read_value( stream, num_steps ) )
+        return false;
+
+    std::vector< Step > index_steps;
+    for( std::uint64_t s = 0; s < num_steps; ++s ) {
+        std::int64_t report_step;
+        std::uint64_t num_keywords;
+        if( !read_value( stream, report_step ) || !read_value( stream, num_keywords ) )
+            return false;
+
+        index_steps.push_back( { int( report_step ), {} } );
+        for( std::uint64_t k = 0; k < num_keywords; ++k ) {
+            char name[ char_length ];
+            char type[ 4 ];
+            std::uint64_t kw_size, offset;
+            if( !stream.read( name, sizeof( name ) ) || !stream.read( type, sizeof( type ) )
+                || !read_value( stream, kw_size ) || !read_value( stream, offset ) )
+                return false;
+
+            Keyword kw{ trim( name, char_length ), std::string( type, 4 ), size_t( kw_size ), offset };
+            try {
+                if( offset + data_size( kw.type, kw.size ) > this->file_size )
+                    return false;
+            } catch( const std::runtime_error& ) {
+                return false;
+            }
+
+            index_steps.back().keywords.push_back( kw );
+        }
+    }
+
+    this->steps = std::move( index_steps );
+    return true;
+}
+
+/*
+  The index is written to a temporary file which is renamed in place,
+  so that several processes loading the same restart file do not see
+  partially written indices.
+*/
+void RestartFile::writeIndexFile() const {
+    const auto index_file = indexFilename( this->m_filename );
+    const auto tmp_file = index_file + "." + std::to_string( ::getpid() );
+    {
+        std::ofstream stream( tmp_file, std::ios::binary | std::ios::trunc );
+        if( !stream )
+            return;
+
+        stream.write( index_magic, sizeof( index_magic ) );
+        write_value( stream, index_version );
+        write_value( stream, this->file_size );
+        write_value( stream, this->mtime_ns );
+        write_value( stream, std::uint64_t( this->steps.size() ) );
+        for( const auto& step : this->steps ) {
+            write_value( stream, std::int64_t( step.report_step ) );
+            write_value( stream, std::uint64_t( step.keywords.size() ) );
+            for( const auto& kw : step.keywords ) {
+                auto name = kw.name;
+                name.resize( char_length, ' ' );
+                stream.write( name.data(), char_length );
+                stream.write( kw.type.data(), 4 );
+                write_value( stream, std::uint64_t( kw.size ) );
+                write_value( stream, kw.offset );
+            }
+        }
+
+        if( !stream ) {
+            stream.close();
+            std::remove( tmp_file.c_str() );
+            return;
+        }
+    }
+
+    if( std::rename( tmp_file.c_str(), index_file.c_str() ) != 0 )
+        std::remove( tmp_file.c_str() );
+}
+
+std::vector< int > RestartFile::reportSteps() const {
+    std::vector< int > report_steps;
+    for( const auto& step : this->steps )
+        report_steps.push_back( step.report_step );
+
+    return report_steps;
+}
+
+const RestartFile::Step& RestartFile::step( int report_step ) const {
+    if( this->steps.size() == 1 && this->steps.front().report_step == -1 )
+        return this->steps.front();
+
+    const auto iter = std::find_if( this->steps.begin(), this->steps.end(),
+                                    [report_step]( const Step& step ) {
+                                        return step.report_step == report_step;
+                                    });
+    if( iter == this->steps.end() )
+        throw std::invalid_argument( "Restart file " + this->m_filename
+                                     + " does not contain data for report step "
+                                     + std::to_string( report_step ) + "!" );
+
+    return *iter;
+}
+
+bool RestartFile::hasReportStep( int report_step ) const {
+    try {
+        this->step( report_step );
+        return true;
+    } catch( const std::invalid_argument& ) {
+        return false;
+    }
+}
+
+bool RestartFile::hasKeyword( int report_step, const std::string& name ) const {
+    if( !this->hasReportStep( report_step ) )
+        return false;
+
+    const auto& keywords = this->step( report_step ).keywords;
+    return std::any_of( keywords.begin(), keywords.end(),
+                        [&name]( const Keyword& kw ) { return kw.name == name; } );
+}
+
+const RestartFile::Keyword& RestartFile::keyword( int report_step, const std::string& name ) const {
+    const auto& keywords = this->step( report_step ).keywords;
+    const auto iter = std::find_if( keywords.begin(), keywords.end(),
+                                    [&name]( const Keyword& kw ) { return kw.name == name; } );
+    if( iter == keywords.end() )
+        throw std::invalid_argument( "Restart file " + this->m_filename
+                                     + " does not contain " + name + " for report step "
+                                     + std::to_string( report_step ) );
+
+    return *iter;
+}
+
+std::vector< int > RestartFile::getInt( int report_step, const std::string& name ) const {
+    const auto& kw = this->keyword( report_step, name );
+    if( kw.type != "INTE" )
+        throw std::invalid_argument( "Restart keyword " + name + " is not an integer keyword" );
+
+    std::vector< int > data( kw.size );
+    if( kw.size == 0 )
+        return data;
+
+    const Mapping mapping( this->fd, kw.offset, data_size( kw.type, kw.size ) );
+    for( size_t start = 0; start < kw.size; start += numeric_block_size ) {
+        const auto n = std::min( numeric_block_size, kw.size - start );
+        const char* src = mapping.data() + ( start / numeric_block_size ) * ( 4 * numeric_block_size + 8 ) + 4;
+        for( size_t i = 0; i < n; ++i )
+            data[ start + i ] = static_cast< std::int32_t >( load_be32( src + 4 * i ) );
+    }
+
+    return data;
+}
+
+std::vector< double > RestartFile::getDouble( int report_step, const std::string& name ) const {
+    std::vector< double > data;
+    read_double( this->fd, this->keyword( report_step, name ), nullptr,
+                 UnitSystem::measure::identity, this->num_threads, data );
+    return data;
+}
+
+void RestartFile::readSI( int report_step,
+                          const std::string& name,
+                          const UnitSystem& units,
+                          UnitSystem::measure dim,
+                          std::vector< double >& data ) const {
+    read_double( this->fd, this->keyword( report_step, name ), &units, dim, this->num_threads, data );
+}
+
+}}
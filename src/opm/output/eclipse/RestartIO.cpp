@@ -20,6 +20,9 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
+#include <algorithm>
+#include <fstream>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -28,6 +31,8 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/Eqldims.hpp>
 
+#include <opm/output/eclipse/EclOutput.hpp>
+#include <opm/output/eclipse/RestartFile.hpp>
 #include <opm/output/eclipse/RestartIO.hpp>
 
 #include <ert/ecl/EclKW.hpp>
@@ -138,8 +143,8 @@ namespace {
 
 
 using rt = data::Rates::opt;
-data::Wells restore_wells( const ecl_kw_type * opm_xwel,
-                           const ecl_kw_type * opm_iwel,
+data::Wells restore_wells( const std::vector< double >& opm_xwel,
+                           const std::vector< int >& opm_iwel,
                            int sim_step,
                            const EclipseState& es,
                            const EclipseGrid& grid,
@@ -166,22 +171,22 @@ data::Wells restore_wells( const ecl_kw_type * opm_xwel,
                                                      0,
                                                      well_size );
 
-    if( ecl_kw_get_size( opm_xwel ) != expected_xwel_size ) {
+    if( int( opm_xwel.size() ) != expected_xwel_size ) {
         throw std::runtime_error(
                 "Mismatch between OPM_XWEL and deck; "
-                "OPM_XWEL size was " + std::to_string( ecl_kw_get_size( opm_xwel ) ) +
+                "OPM_XWEL size was " + std::to_string( opm_xwel.size() ) +
                 ", expected " + std::to_string( expected_xwel_size ) );
     }
 
-    if( ecl_kw_get_size( opm_iwel ) != int(sched_wells.size()) )
+    if( opm_iwel.size() != sched_wells.size() )
         throw std::runtime_error(
                 "Mismatch between OPM_IWEL and deck; "
-                "OPM_IWEL size was " + std::to_string( ecl_kw_get_size( opm_iwel ) ) +
+                "OPM_IWEL size was " + std::to_string( opm_iwel.size() ) +
                 ", expected " + std::to_string( sched_wells.size() ) );
 
     data::Wells wells;
-    const double * opm_xwel_data = ecl_kw_get_double_ptr( opm_xwel );
-    const int * opm_iwel_data = ecl_kw_get_int_ptr( opm_iwel );
+    const double * opm_xwel_data = opm_xwel.data();
+    const int * opm_iwel_data = opm_iwel.data();
     for( const auto* sched_well : sched_wells ) {
         data::Well& well = wells[ sched_well->name() ];
 
@@ -213,16 +218,18 @@ data::Wells restore_wells( const ecl_kw_type * opm_xwel,
 
     return wells;
 }
-}
 
-/* should take grid as argument because it may be modified from the simulator */
-RestartValue load( const std::string& filename,
-                   int report_step,
-                   const std::vector<RestartKey>& solution_keys,
-                   const EclipseState& es,
-                   const EclipseGrid& grid,
-                   const Schedule& schedule,
-                   const std::vector<RestartKey>& extra_keys) {
+/*
+  Formatted restart files are read with libecl, which loads the whole
+  file and converts the keywords after they have been copied out.
+*/
+RestartValue load_formatted( const std::string& filename,
+                             int report_step,
+                             const std::vector<RestartKey>& solution_keys,
+                             const EclipseState& es,
+                             const EclipseGrid& grid,
+                             const Schedule& schedule,
+                             const std::vector<RestartKey>& extra_keys) {
 
     int sim_step = std::max(report_step - 1, 0);
     const bool unified                   = ( ERT::EclFiletype( filename ) == ECL_UNIFIED_RESTART_FILE );
@@ -244,10 +251,13 @@ RestartValue load( const std::string& filename,
     const ecl_kw_type * intehead = ecl_file_view_iget_named_kw( file_view , "INTEHEAD", 0 );
     const ecl_kw_type * opm_xwel = ecl_file_view_iget_named_kw( file_view , "OPM_XWEL", 0 );
     const ecl_kw_type * opm_iwel = ecl_file_view_iget_named_kw( file_view, "OPM_IWEL", 0 );
+    const int * opm_iwel_data = ecl_kw_get_int_ptr( opm_iwel );
 
     UnitSystem units( static_cast<ert_ecl_unit_enum>(ecl_kw_iget_int( intehead , INTEHEAD_UNIT_INDEX )));
     RestartValue rst_value( restoreSOLUTION( file_view, solution_keys, grid.getNumActive( )),
-                            restore_wells( opm_xwel, opm_iwel, sim_step , es, grid, schedule));
+                            restore_wells( double_vector( opm_xwel ),
+                                           { opm_iwel_data, opm_iwel_data + ecl_kw_get_size( opm_iwel ) },
+                                           sim_step , es, grid, schedule));
 
     for (const auto& extra : extra_keys) {
         const std::string& key = extra.key;
@@ -275,6 +285,95 @@ RestartValue load( const std::string& filename,
     return rst_value;
 }
 
+/*
+  Unformatted restart files are read with RestartFile; only the keyword
+  headers and the requested keywords of the report step are read, and
+  the keywords are converted to SI units directly into the RestartValue.
+  The keyword index of unified files is kept in a file next to the
+  restart file.
+*/
+RestartValue load_unformatted( const std::string& filename,
+                               int report_step,
+                               const std::vector<RestartKey>& solution_keys,
+                               const EclipseState& es,
+                               const EclipseGrid& grid,
+                               const Schedule& schedule,
+                               const std::vector<RestartKey>& extra_keys) {
+
+    int sim_step = std::max(report_step - 1, 0);
+    const bool unified = ( ERT::EclFiletype( filename ) == ECL_UNIFIED_RESTART_FILE );
+    const RestartFile rst_file( filename, unified );
+
+    if( !rst_file.hasReportStep( report_step ) )
+        throw std::runtime_error( "Restart file " + filename
+                                  + " does not contain data for report step "
+                                  + std::to_string( report_step ) + "!" );
+
+    const auto intehead = rst_file.getInt( report_step, "INTEHEAD" );
+    UnitSystem units( static_cast<ert_ecl_unit_enum>( intehead.at( INTEHEAD_UNIT_INDEX ) ));
+
+    data::Solution sol;
+    for (const auto& value : solution_keys) {
+        const std::string& key = value.key;
+
+        if( !rst_file.hasKeyword( report_step, key ) ) {
+            if (value.required)
+                throw std::runtime_error("Read of restart file: "
+                                         "File does not contain "
+                                         + key
+                                         + " data" );
+            else
+                continue;
+        }
+
+        if( rst_file.keyword( report_step, key ).size != grid.getNumActive() )
+            throw std::runtime_error("Restart file: Could not restore "
+                                     + key
+                                     + ", mismatched number of cells" );
+
+        std::vector<double> data;
+        rst_file.readSI( report_step, key, units, value.dim, data );
+        sol.insert( key, value.dim, std::move( data ), data::TargetType::RESTART_SOLUTION );
+    }
+
+    RestartValue rst_value( std::move( sol ),
+                            restore_wells( rst_file.getDouble( report_step, OPM_XWEL ),
+                                           rst_file.getInt( report_step, OPM_IWEL ),
+                                           sim_step , es, grid, schedule));
+
+    for (const auto& extra : extra_keys) {
+        const std::string& key = extra.key;
+
+        if (rst_file.hasKeyword( report_step, key )) {
+            std::vector<double> data;
+            rst_file.readSI( report_step, key, units, extra.dim, data );
+            rst_value.addExtra(key, extra.dim, std::move( data ));
+        } else if (extra.required)
+            throw std::runtime_error("No such key in file: " + key);
+    }
+
+    return rst_value;
+}
+}
+
+/* should take grid as argument because it may be modified from the simulator */
+RestartValue load( const std::string& filename,
+                   int report_step,
+                   const std::vector<RestartKey>& solution_keys,
+                   const EclipseState& es,
+                   const EclipseGrid& grid,
+                   const Schedule& schedule,
+                   const std::vector<RestartKey>& extra_keys) {
+
+    bool formatted = false;
+    ecl_util_fmt_file( filename.c_str(), &formatted );
+
+    if (formatted)
+        return load_formatted( filename, report_step, solution_keys, es, grid, schedule, extra_keys );
+
+    return load_unformatted( filename, report_step, solution_keys, es, grid, schedule, extra_keys );
+}
+
 
 
 
@@ -425,12 +524,12 @@ std::vector< double > serialize_OPM_XWEL( const data::Wells& wells,
 }
 
 
-std::vector<const char*> serialize_ZWEL( const std::vector<const Well *>& wells) {
-    std::vector<const char*> data( wells.size( ) * NZWELZ , "");
+std::vector<std::string> serialize_ZWEL( const std::vector<const Well *>& wells) {
+    std::vector<std::string> data( wells.size( ) * NZWELZ , "");
     size_t offset = 0;
 
     for (const auto& well : wells) {
-        data[ offset ] = well->name().c_str();
+        data[ offset ] = well->name();
         offset += NZWELZ;
     }
     return data;
@@ -440,11 +539,6 @@ std::vector<const char*> serialize_ZWEL( const std::vector<const Well *>& wells)
 
 
 
-template< typename T >
-void write_kw(ecl_rst_file_type * rst_file , ERT::EclKW< T >&& kw) {
-    ecl_rst_file_add_kw( rst_file, kw.get() );
-}
-
 void writeHeader(ecl_rst_file_type * rst_file,
                  int sim_step,
                  int report_step,
@@ -479,57 +573,133 @@ void writeHeader(ecl_rst_file_type * rst_file,
     ecl_rst_file_fwrite_header( rst_file, report_step , &rsthead_data );
 }
 
-  ERT::ert_unique_ptr< ecl_kw_type, ecl_kw_free > ecl_kw( const std::string& kw, const std::vector<double>& data, bool write_double) {
+  /*
+    Copies the data into the keyword storage at output, converting from
+    SI units in blocks of a fixed size; the only temporary storage is
+    one such block.
+  */
+  template< typename T >
+  void copy_from_si( const std::vector<double>& data, const UnitSystem& units, UnitSystem::measure dim, T* output) {
+      if (dim == UnitSystem::measure::identity) {
+          std::copy( data.begin(), data.end(), output );
+          return;
+      }
+
+      const size_t block_size = 4096;
+      std::vector<double> block;
+      block.reserve( std::min( block_size, data.size() ));
+      for (size_t start = 0; start < data.size(); start += block_size) {
+          const auto end = std::min( data.size(), start + block_size );
+          block.assign( data.begin() + start, data.begin() + end );
+          units.from_si( dim, block );
+          std::copy( block.begin(), block.end(), output + start );
+      }
+  }
+
+
+  /*
+    Data which are written as double without conversion are shared with
+    the keyword; otherwise the keyword is allocated and the data are
+    converted - and narrowed to float - directly into it.
+  */
+  ERT::ert_unique_ptr< ecl_kw_type, ecl_kw_free > ecl_kw( const std::string& kw, const std::vector<double>& data, const UnitSystem& units, UnitSystem::measure dim, bool write_double) {
       ERT::ert_unique_ptr< ecl_kw_type, ecl_kw_free > kw_ptr;
 
       if (write_double) {
-          ecl_kw_type * ecl_kw = ecl_kw_alloc( kw.c_str() , data.size() , ECL_DOUBLE );
-          ecl_kw_set_memcpy_data( ecl_kw , data.data() );
-          kw_ptr.reset( ecl_kw );
+          if (dim == UnitSystem::measure::identity)
+              kw_ptr.reset( ecl_kw_alloc_new_shared( kw.c_str() , data.size() , ECL_DOUBLE , const_cast<double *>(data.data())));
+          else {
+              kw_ptr.reset( ecl_kw_alloc( kw.c_str() , data.size() , ECL_DOUBLE ));
+              copy_from_si( data, units, dim, ecl_kw_get_double_ptr( kw_ptr.get() ));
+          }
       } else {
-          ecl_kw_type * ecl_kw = ecl_kw_alloc( kw.c_str() , data.size() , ECL_FLOAT );
-          float * float_data = ecl_kw_get_float_ptr( ecl_kw );
-          for (size_t i=0; i < data.size(); i++)
-              float_data[i] = data[i];
-          kw_ptr.reset( ecl_kw );
+          kw_ptr.reset( ecl_kw_alloc( kw.c_str() , data.size() , ECL_FLOAT ));
+          copy_from_si( data, units, dim, ecl_kw_get_float_ptr( kw_ptr.get() ));
       }
 
       return kw_ptr;
   }
 
 
+  /*
+    Formatted restart files are written with libecl; this class gives
+    the ecl_rst_file the interface of out::EclOutput, which is used for
+    the unformatted files, so that both can be written by the same
+    functions.
+  */
+  class ErtRestartOutput {
+  public:
+      explicit ErtRestartOutput( ecl_rst_file_type* rst_file_arg ) :
+          rst_file( rst_file_arg )
+      {}
+
+      void write( const std::string& name, const std::vector<int>& data ) {
+          ecl_rst_file_add_kw( this->rst_file, ERT::EclKW< int >( name, data ).get() );
+      }
+
+      void write( const std::string& name, const std::vector<double>& data ) {
+          ecl_rst_file_add_kw( this->rst_file, ERT::EclKW< double >( name, data ).get() );
+      }
+
+      void write( const std::string& name, const std::vector<std::string>& data ) {
+          std::vector<const char*> strings;
+          for (const auto& value : data)
+              strings.push_back( value.c_str() );
+
+          ecl_rst_file_add_kw( this->rst_file, ERT::EclKW< const char* >( name, strings ).get() );
+      }
+
+      void writeFromSI( const std::string& name, const std::vector<double>& data, const UnitSystem& units, UnitSystem::measure dim, bool write_double ) {
+          ecl_rst_file_add_kw( this->rst_file, ecl_kw( name, data, units, dim, write_double ).get() );
+      }
+
+      void message( const std::string& name ) {
+          ERT::ert_unique_ptr< ecl_kw_type, ecl_kw_free > kw( ecl_kw_alloc( name.c_str(), 0, ECL_MESS ));
+          ecl_rst_file_add_kw( this->rst_file, kw.get() );
+      }
+
+  private:
+      ecl_rst_file_type* rst_file;
+  };
+
+
+
+  template< typename Output >
+  void writeSolution(Output& output, const data::Solution& solution, const UnitSystem& units, bool write_double) {
+    // A solution which is not in SI units is written as it is.
+    const auto dim = [&solution]( const data::CellData& cell_data ) {
+        return solution.isSI() ? cell_data.dim : UnitSystem::measure::identity;
+    };
 
-  void writeSolution(ecl_rst_file_type* rst_file, const data::Solution& solution, bool write_double) {
-    ecl_rst_file_start_solution( rst_file );
+    output.message( STARTSOL_KW );
     for (const auto& elm: solution) {
         if (elm.second.target == data::TargetType::RESTART_SOLUTION)
-            ecl_rst_file_add_kw( rst_file , ecl_kw(elm.first, elm.second.data, write_double).get());
+            output.writeFromSI( elm.first, elm.second.data, units, dim( elm.second ), write_double );
      }
-     ecl_rst_file_end_solution( rst_file );
+     output.message( ENDSOL_KW );
 
      for (const auto& elm: solution) {
         if (elm.second.target == data::TargetType::RESTART_AUXILIARY)
-            ecl_rst_file_add_kw( rst_file , ecl_kw(elm.first, elm.second.data, write_double).get());
+            output.writeFromSI( elm.first, elm.second.data, units, dim( elm.second ), write_double );
      }
   }
 
 
-  void writeExtraData(ecl_rst_file_type* rst_file, const RestartValue::ExtraVector& extra_data) {
+  template< typename Output >
+  void writeExtraData(Output& output, const RestartValue::ExtraVector& extra_data, const UnitSystem& units) {
     for (const auto& extra_value : extra_data) {
         const std::string& key = extra_value.first.key;
         const std::vector<double>& data = extra_value.second;
-        {
-            ecl_kw_type * ecl_kw = ecl_kw_alloc_new_shared( key.c_str() , data.size() , ECL_DOUBLE , const_cast<double *>(data.data()));
-            ecl_rst_file_add_kw( rst_file , ecl_kw);
-            ecl_kw_free( ecl_kw );
-        }
+
+        output.writeFromSI( key, data, units, extra_value.first.dim, true );
     }
 }
 
 
 
-void writeWell(ecl_rst_file_type* rst_file, int sim_step, const EclipseState& es , const EclipseGrid& grid, const Schedule& schedule, const data::Wells& wells) {
-    const auto sched_wells  = schedule.getWells(sim_step);
+template< typename Output >
+void writeWell(Output& output, int sim_step, const EclipseState& es , const EclipseGrid& grid, const Schedule& schedule, const data::Wells& wells) {
+    const auto& sched_wells = schedule.getWells(sim_step);
     const auto& phases = es.runspec().phases();
     const size_t ncwmax = schedule.getMaxNumConnectionsForWells(sim_step);
 
@@ -539,21 +709,15 @@ void writeWell(ecl_rst_file_type* rst_file, int sim_step, const EclipseState& es
     const auto icon_data = serialize_ICON(sim_step , ncwmax, sched_wells, grid);
     const auto zwel_data = serialize_ZWEL( sched_wells );
 
-    write_kw( rst_file, ERT::EclKW< int >( IWEL_KW, iwel_data) );
-    write_kw( rst_file, ERT::EclKW< const char* >(ZWEL_KW, zwel_data ) );
-    write_kw( rst_file, ERT::EclKW< double >( OPM_XWEL, opm_xwel ) );
-    write_kw( rst_file, ERT::EclKW< int >( OPM_IWEL, opm_iwel ) );
-    write_kw( rst_file, ERT::EclKW< int >( ICON_KW, icon_data ) );
+    output.write( IWEL_KW, iwel_data );
+    output.write( ZWEL_KW, zwel_data );
+    output.write( OPM_XWEL, opm_xwel );
+    output.write( OPM_IWEL, opm_iwel );
+    output.write( ICON_KW, icon_data );
 }
 
-void checkSaveArguments(const EclipseState& es,
-                        const RestartValue& restart_value,
-                        const EclipseGrid& grid) {
-
-  for (const auto& elm: restart_value.solution)
-    if (elm.second.data.size() != grid.getNumActive())
-      throw std::runtime_error("Wrong size on solution vector: " + elm.first);
-
+void checkExtraData(const EclipseState& es,
+                    const RestartValue& restart_value) {
 
   if (es.getSimulationConfig().getThresholdPressure().size() > 0) {
       // If the the THPRES option is active the restart_value should have a
@@ -570,13 +734,88 @@ void checkSaveArguments(const EclipseState& es,
           throw std::runtime_error("THPRES vector has invalid size - should have num_region * num_regions.");
   }
 }
+
+void checkSaveArguments(const EclipseState& es,
+                        const RestartValue& restart_value,
+                        const EclipseGrid& grid) {
+
+  for (const auto& elm: restart_value.solution)
+    if (elm.second.data.size() != grid.getNumActive())
+      throw std::runtime_error("Wrong size on solution vector: " + elm.first);
+
+  checkExtraData(es, restart_value);
+}
+
+
+/*
+  Opens the restart file - positioned at the report step, and truncated,
+  for a unified file - and writes the header.
+*/
+ERT::ert_unique_ptr< ecl_rst_file_type, ecl_rst_file_close > openRestartFile(const std::string& filename,
+                                                                           int report_step,
+                                                                           double seconds_elapsed,
+                                                                           const EclipseState& es,
+                                                                           const EclipseGrid& grid,
+                                                                           const Schedule& schedule) {
+    int sim_step = std::max(report_step - 1, 0);
+    int ert_phase_mask = es.runspec().eclPhaseMask( );
+    const auto& units = es.getUnits();
+    time_t posix_time = schedule.posixStartTime() + seconds_elapsed;
+    const auto sim_time = units.from_si( UnitSystem::measure::time, seconds_elapsed );
+    ERT::ert_unique_ptr< ecl_rst_file_type, ecl_rst_file_close > rst_file;
+
+    if (ERT::EclFiletype( filename ) == ECL_UNIFIED_RESTART_FILE)
+        rst_file.reset( ecl_rst_file_open_write_seek( filename.c_str(), report_step ) );
+    else
+        rst_file.reset( ecl_rst_file_open_write( filename.c_str() ) );
+
+    writeHeader( rst_file.get(), sim_step, report_step, posix_time , sim_time, ert_phase_mask, units, schedule , grid );
+    return rst_file;
+}
+
+
+/*
+  The file offsets of the solution keywords written by writeSolution(),
+  when the STARTSOL keyword is written at offset; these only depend on
+  the names and targets of the solution fields, and the number of
+  active cells.
+*/
+struct SolutionLayout {
+    std::uint64_t startsol;
+    std::uint64_t endsol;
+    std::uint64_t end;
+    std::vector< std::pair< const data::Solution::value_type*, std::uint64_t > > fields;
+};
+
+SolutionLayout solutionLayout(const data::Solution& solution, size_t num_active, bool write_double, std::uint64_t offset) {
+    SolutionLayout layout;
+    layout.startsol = offset;
+    offset += out::EclPositionedOutput::keywordSize( 0, write_double );
+
+    const auto add_fields = [&]( data::TargetType target ) {
+        for (const auto& elm: solution) {
+            if (elm.second.target == target) {
+                layout.fields.emplace_back( &elm, offset );
+                offset += out::EclPositionedOutput::keywordSize( num_active, write_double );
+            }
+        }
+    };
+
+    add_fields( data::TargetType::RESTART_SOLUTION );
+    layout.endsol = offset;
+    offset += out::EclPositionedOutput::keywordSize( 0, write_double );
+    add_fields( data::TargetType::RESTART_AUXILIARY );
+
+    layout.end = offset;
+    return layout;
+}
 } // Anonymous namespace
 
 
 void save(const std::string& filename,
           int report_step,
           double seconds_elapsed,
-          RestartValue value,
+          const RestartValue& value,
           const EclipseState& es,
           const EclipseGrid& grid,
           const Schedule& schedule,
@@ -585,30 +824,137 @@ void save(const std::string& filename,
     checkSaveArguments(es, value, grid);
     {
         int sim_step = std::max(report_step - 1, 0);
-        int ert_phase_mask = es.runspec().eclPhaseMask( );
         const auto& units = es.getUnits();
-        time_t posix_time = schedule.posixStartTime() + seconds_elapsed;
-        const auto sim_time = units.from_si( UnitSystem::measure::time, seconds_elapsed );
-        ERT::ert_unique_ptr< ecl_rst_file_type, ecl_rst_file_close > rst_file;
-
-        if (ERT::EclFiletype( filename ) == ECL_UNIFIED_RESTART_FILE)
-            rst_file.reset( ecl_rst_file_open_write_seek( filename.c_str(), report_step ) );
-        else
-            rst_file.reset( ecl_rst_file_open_write( filename.c_str() ) );
-
-        // Convert solution fields and extra values from SI to user units.
-        value.solution.convertFromSI(units);
-        for (auto & extra_value : value.extra) {
-            const auto& restart_key = extra_value.first;
-            auto & data = extra_value.second;
-
-            units.from_si(restart_key.dim, data);
+        auto rst_file = openRestartFile( filename, report_step, seconds_elapsed, es, grid, schedule );
+
+        const auto write_data = [&]( auto& output ) {
+            writeWell( output, sim_step, es , grid, schedule, value.wells);
+            writeSolution( output, value.solution, units, write_double );
+            writeExtraData( output, value.extra, units );
+        };
+
+        /*
+          The header, and the positioning in a unified file, is handled
+          by libecl; for unformatted files the keywords are then appended
+          with the buffered EclOutput writer.
+        */
+        bool formatted = false;
+        ecl_util_fmt_file( filename.c_str(), &formatted );
+        if (formatted) {
+            ErtRestartOutput output( rst_file.get() );
+            write_data( output );
+        } else {
+            rst_file.reset();
+            out::EclOutput output( filename, true );
+            write_data( output );
+            output.close();
         }
+    }
+}
+
+
+std::uint64_t saveLayout(const std::string& filename,
+                         int report_step,
+                         double seconds_elapsed,
+                         const RestartValue& value,
+                         const EclipseState& es,
+                         const EclipseGrid& grid,
+                         const Schedule& schedule,
+                         bool write_double)
+{
+    bool formatted = false;
+    ecl_util_fmt_file( filename.c_str(), &formatted );
+    if (formatted)
+        throw std::invalid_argument("Distributed restart output requires an unformatted file: " + filename);
+
+    checkExtraData(es, value);
+
+    int sim_step = std::max(report_step - 1, 0);
+    const auto& units = es.getUnits();
+    openRestartFile( filename, report_step, seconds_elapsed, es, grid, schedule );
 
-        writeHeader( rst_file.get(), sim_step, report_step, posix_time , sim_time, ert_phase_mask, units, schedule , grid );
-        writeWell( rst_file.get(), sim_step, es , grid, schedule, value.wells);
-        writeSolution( rst_file.get(), value.solution, write_double );
-        writeExtraData( rst_file.get(), value.extra );
+    std::uint64_t offset;
+    {
+        out::EclOutput output( filename, true );
+        writeWell( output, sim_step, es , grid, schedule, value.wells);
+        output.close();
+
+        std::ifstream stream( filename, std::ios::binary | std::ios::ate );
+        if (!stream)
+            throw std::runtime_error("Could not open restart file " + filename);
+
+        offset = stream.tellg();
+    }
+
+    const auto layout = solutionLayout( value.solution, grid.getNumActive(), write_double, offset );
+    {
+        out::EclPositionedOutput output( filename );
+        output.resize( layout.end );
+        output.message( layout.startsol, STARTSOL_KW );
+        for (const auto& field : layout.fields)
+            output.writeHeader( field.second, field.first->first, grid.getNumActive(), write_double );
+        output.message( layout.endsol, ENDSOL_KW );
+    }
+
+    out::EclOutput output( filename, true );
+    writeExtraData( output, value.extra, units );
+    output.close();
+
+    return offset;
+}
+
+
+void saveSolutionSlice(const std::string& filename,
+                       std::uint64_t solution_offset,
+                       const data::Solution& solution,
+                       const std::vector<int>& global_index,
+                       const UnitSystem& units,
+                       size_t num_active,
+                       bool write_double)
+{
+    const size_t size = global_index.size();
+    std::vector<size_t> order( size );
+    std::iota( order.begin(), order.end(), 0 );
+    std::sort( order.begin(), order.end(), [&global_index]( size_t a, size_t b ) {
+        return global_index[a] < global_index[b];
+    });
+
+    std::vector<size_t> sorted_index( size );
+    for (size_t k = 0; k < size; ++k) {
+        const auto index = global_index[order[k]];
+        if (index < 0 || size_t( index ) >= num_active)
+            throw std::invalid_argument("Global active index " + std::to_string( index ) + " is out of range");
+
+        if (k > 0 && size_t( index ) == sorted_index[k - 1])
+            throw std::invalid_argument("Global active index " + std::to_string( index ) + " is given twice");
+
+        sorted_index[k] = index;
+    }
+
+    const auto layout = solutionLayout( solution, num_active, write_double, solution_offset );
+    out::EclPositionedOutput output( filename );
+    std::vector<double> values( size );
+    for (const auto& field : layout.fields) {
+        const auto& cell_data = field.first->second;
+        if (cell_data.data.size() != size)
+            throw std::runtime_error("Wrong size on solution vector: " + field.first->first);
+
+        for (size_t k = 0; k < size; ++k)
+            values[k] = cell_data.data[order[k]];
+
+        if (solution.isSI())
+            units.from_si( cell_data.dim, values );
+
+        // One write for every run of consecutive global indices.
+        size_t first = 0;
+        while (first < size) {
+            size_t last = first + 1;
+            while (last < size && sorted_index[last] == sorted_index[last - 1] + 1)
+                ++last;
+
+            output.writeRange( field.second, num_active, sorted_index[first], values.data() + first, last - first, write_double );
+            first = last;
+        }
     }
 }
 }
@@ -17,12 +17,15 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <exception>
 #include <initializer_list>
 #include <iterator>
 #include <numeric>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 
@@ -36,10 +39,12 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/WellProductionProperties.hpp>
 #include <opm/parser/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
 #include <opm/parser/eclipse/Units/UnitSystem.hpp>
+#include <opm/parser/eclipse/Units/Units.hpp>
 
 #include <opm/output/eclipse/SummaryState.hpp>
 #include <opm/output/eclipse/Summary.hpp>
 #include <opm/output/eclipse/RegionCache.hpp>
+#include <opm/output/eclipse/SummaryWriter.hpp>
 
 #include <ert/ecl/ecl_smspec.h>
 #include <ert/ecl/ecl_kw_magic.h>
@@ -229,22 +234,202 @@ struct quantity {
     }
 };
 
+/*
+ * The group and field rates are rolled up from the well rates once per time
+ * step and quantity, instead of every group and field vector summing all of
+ * its wells. The well rates are accumulated in the leaf groups of the group
+ * tree, and every group passes its sum, scaled by its GEFAC, on to its parent
+ * group. This gives the rate of a group without its own GEFAC, and the
+ * product of the GEFACs from a group up to and including FIELD (total_factor)
+ * is applied for cumulative group volumes. As for the wells of a group, the
+ * wells directly below a group with child groups are not included.
+ *
+ * The field vectors cover all wells in the schedule, and every well is
+ * weighted with its WEFAC and the GEFACs of all its groups.
+ */
+class well_rollup {
+    public:
+        void compile( const Schedule& schedule, int sim_step,
+                      const std::unordered_map< std::string, size_t >& result_index ) {
+            const auto& tree = schedule.getGroupTree( sim_step );
+            const auto num_groups = tree.size();
+
+            this->tree = &tree;
+            this->order.clear();
+            this->gefac.assign( num_groups, 1.0 );
+            this->chain.assign( num_groups, 1.0 );
+            this->leaf_wells.assign( num_groups, {} );
+            this->field_wells.clear();
+            this->clear();
+
+            /* depth first walk from FIELD; parents come before their children */
+            std::vector< int > preorder;
+            std::vector< int > stack = { 0 };
+            while( !stack.empty() ) {
+                const int id = stack.back();
+                stack.pop_back();
+                preorder.push_back( id );
+
+                for( int child = tree.firstChild( id ); child >= 0; child = tree.nextSibling( child ) )
+                    stack.push_back( child );
+            }
+
+            for( const int id : preorder ) {
+                const auto& group = schedule.getGroup( tree.groupName( id ) );
+                const int parent = tree.parentId( id );
+
+                this->gefac[ id ] = group.getGroupEfficiencyFactor( sim_step );
+                this->chain[ id ] = this->gefac[ id ] * ( parent < 0 ? 1.0 : this->chain[ parent ] );
+
+                if( !group.hasBeenDefined( sim_step ) )
+                    continue;
+
+                this->order.push_back( id );
+                if( tree.firstChild( id ) >= 0 )
+                    continue;
+
+                for( const auto& well_name : group.getWells( sim_step ) ) {
+                    const auto* well = schedule.getWell( well_name );
+                    this->leaf_wells[ id ].push_back( make_member( *well, sim_step, result_index, 1.0 ) );
+                }
+            }
+            std::reverse( this->order.begin(), this->order.end() );
+
+            for( const auto* well : schedule.getWells() ) {
+                double factor = 1.0;
+                if( well->hasBeenDefined( sim_step ) && tree.exists( well->getGroupName( sim_step ) ) )
+                    factor = this->chain[ tree.groupId( well->getGroupName( sim_step ) ) ];
+
+                this->field_wells.push_back( make_member( *well, sim_step, result_index, factor ) );
+            }
+        }
+
+        /* The rolled up sums are only valid for one set of well results. */
+        void clear() {
+            this->group_sums.clear();
+            this->field_sums.clear();
+        }
+
+        double total_factor( int group ) const {
+            return this->chain[ group ];
+        }
+
+        /*
+         * The summed rate of a group, or of the field when group is
+         * negative. As for the individual wells, the sum only includes the
+         * injecting or the producing wells.
+         */
+        double rate( rt phase, bool injection, bool polymer, int group,
+                     const std::vector< const data::Well* >& well_results ) {
+            const auto key = ( static_cast< Rates::enum_size >( phase ) << 2 )
+                           | ( injection ? 2 : 0 )
+                           | ( polymer ? 1 : 0 );
+
+            if( group < 0 ) {
+                auto iter = this->field_sums.find( key );
+                if( iter == this->field_sums.end() ) {
+                    double sum = 0.0;
+                    for( const auto& well : this->field_wells )
+                        sum += contribution( well, phase, injection, polymer, well_results );
+
+                    iter = this->field_sums.emplace( key, sum ).first;
+                }
+
+                return iter->second;
+            }
+
+            auto iter = this->group_sums.find( key );
+            if( iter == this->group_sums.end() ) {
+                std::vector< double > sums( this->gefac.size(), 0.0 );
+
+                for( const int id : this->order ) {
+                    double sum = 0.0;
+                    int child = this->tree->firstChild( id );
+
+                    if( child < 0 ) {
+                        for( const auto& well : this->leaf_wells[ id ] )
+                            sum += contribution( well, phase, injection, polymer, well_results );
+                    }
+
+                    for( ; child >= 0; child = this->tree->nextSibling( child ) )
+                        sum += this->gefac[ child ] * sums[ child ];
+
+                    sums[ id ] = sum;
+                }
+
+                iter = this->group_sums.emplace( key, std::move( sums ) ).first;
+            }
+
+            return iter->second[ group ];
+        }
+
+    private:
+        using Rates = data::Rates;
+
+        struct member {
+            size_t result;
+            double factor;
+            double concentration;
+        };
+
+        static member make_member( const Well& well, int sim_step,
+                                   const std::unordered_map< std::string, size_t >& result_index,
+                                   double factor ) {
+            const bool defined = well.hasBeenDefined( sim_step );
+            return { result_index.at( well.name() ),
+                     defined ? factor * well.getEfficiencyFactor( sim_step ) : 1.0,
+                     well.getPolymerProperties( sim_step ).m_polymerConcentration };
+        }
+
+        static double contribution( const member& well, rt phase, bool injection, bool polymer,
+                                    const std::vector< const data::Well* >& well_results ) {
+            const auto* result = well_results[ well.result ];
+            if( !result ) return 0.0;
+
+            const auto v = result->rates.get( phase, 0.0 );
+            if( ( v > 0 ) != injection ) return 0.0;
+
+            return v * well.factor * ( polymer ? well.concentration : 1.0 );
+        }
+
+        const GroupTree* tree = nullptr;
+        std::vector< int > order;
+        std::vector< double > gefac;
+        std::vector< double > chain;
+        std::vector< std::vector< member > > leaf_wells;
+        std::vector< member > field_wells;
+        std::unordered_map< Rates::enum_size, std::vector< double > > group_sums;
+        std::unordered_map< Rates::enum_size, double > field_sums;
+};
+
 /*
  * All functions must have the same parameters, so they're gathered in a struct
  * and functions use whatever information they care about.
  *
  * schedule_wells are wells from the deck, provided by opm-parser. active_index
- * is the index of the block in question. wells is simulation data.
+ * is the index of the block in question. well_results is the simulation data
+ * of all the wells in the schedule, and well_index gives the position of each
+ * of the schedule_wells in well_results; wells without simulation data are
+ * nullptr. eff_factors are the efficiency factors of the schedule_wells, and
+ * for region vectors connection_wells gives the position in schedule_wells of
+ * each of the region connections. For group and field vectors rollup holds the
+ * rolled up well rates, group is the GroupTree id of a group vector (-1 for
+ * field vectors), and group_factor the GEFACs applied to the group's rates.
  */
 struct fn_args {
     const std::vector< const Well* >& schedule_wells;
     double duration;
     const int sim_step;
     int  num;
-    const data::Wells& wells;
+    const std::vector< size_t >& well_index;
+    const std::vector< const data::Well* >& well_results;
     const out::RegionCache& regionCache;
     const EclipseGrid& grid;
-    const std::vector< std::pair< std::string, double > > eff_factors;
+    const std::vector< double >& eff_factors;
+    const std::vector< size_t >& connection_wells;
+    well_rollup* rollup;
+    int group;
+    double group_factor;
 };
 
 /* Since there are several enums in opm scattered about more-or-less
@@ -274,30 +459,30 @@ measure rate_unit< rt::reservoir_oil >() { return measure::rate; }
 template<> constexpr
 measure rate_unit< rt::reservoir_gas >() { return measure::rate; }
 
-double efac( const std::vector<std::pair<std::string,double>>& eff_factors, const std::string& name ) {
-    auto it = std::find_if( eff_factors.begin(), eff_factors.end(),
-                            [&] ( const std::pair< std::string, double > elem )
-                            { return elem.first == name; }
-                          );
-
-    return (it != eff_factors.end()) ? it->second : 1;
+inline const data::Well* well_result( const fn_args& args, size_t well ) {
+    return args.well_results[ args.well_index[ well ] ];
 }
 
 template< rt phase, bool injection = true, bool polymer = false >
 inline quantity rate( const fn_args& args ) {
     double sum = 0.0;
 
-    for( const auto* sched_well : args.schedule_wells ) {
-        const auto& name = sched_well->name();
-        if( args.wells.count( name ) == 0 ) continue;
+    if( args.rollup ) {
+        sum = args.rollup->rate( phase, injection, polymer, args.group, args.well_results )
+            * args.group_factor;
+    }
+    else for( size_t well = 0; well < args.schedule_wells.size(); ++well ) {
+        const auto* result = well_result( args, well );
+        if( !result ) continue;
 
-        double eff_fac = efac( args.eff_factors, name );
+        const auto* sched_well = args.schedule_wells[ well ];
+        double eff_fac = args.eff_factors[ well ];
 
         double concentration = polymer
                              ? sched_well->getPolymerProperties( args.sim_step ).m_polymerConcentration
                              : 1;
 
-        const auto v = args.wells.at(name).rates.get(phase, 0.0) * eff_fac * concentration;
+        const auto v = result->rates.get(phase, 0.0) * eff_fac * concentration;
 
         if( ( v > 0 ) == injection )
             sum += v;
@@ -311,19 +496,17 @@ inline quantity rate( const fn_args& args ) {
 
 template< bool injection >
 inline quantity flowing( const fn_args& args ) {
-    const auto& wells = args.wells;
-    const auto ts = args.sim_step;
-    auto pred = [&wells,ts]( const Well* w ) {
-        const auto& name = w->name();
-        return w->isInjector( ts ) == injection
-            && wells.count( name ) > 0
-            && wells.at( name ).flowing();
-    };
+    size_t count = 0;
+
+    for( size_t well = 0; well < args.schedule_wells.size(); ++well ) {
+        const auto* result = well_result( args, well );
+        if( args.schedule_wells[ well ]->isInjector( args.sim_step ) == injection
+            && result
+            && result->flowing() )
+            ++count;
+    }
 
-    return { double( std::count_if( args.schedule_wells.begin(),
-                                    args.schedule_wells.end(),
-                                    pred ) ),
-             measure::identity };
+    return { double( count ), measure::identity };
 }
 
 template< rt phase, bool injection = true, bool polymer = false >
@@ -337,19 +520,18 @@ inline quantity crate( const fn_args& args ) {
     if( args.schedule_wells.empty() ) return zero;
 
     const auto& well = args.schedule_wells.front();
-    const auto& name = well->name();
-    if( args.wells.count( name ) == 0 ) return zero;
+    const auto* well_data = well_result( args, 0 );
+    if( !well_data ) return zero;
 
-    const auto& well_data = args.wells.at( name );
-    const auto& completion = std::find_if( well_data.connections.begin(),
-                                           well_data.connections.end(),
+    const auto& completion = std::find_if( well_data->connections.begin(),
+                                           well_data->connections.end(),
                                            [=]( const data::Connection& c ) {
                                                 return c.index == global_index;
                                            } );
 
-    if( completion == well_data.connections.end() ) return zero;
+    if( completion == well_data->connections.end() ) return zero;
 
-    double eff_fac = efac( args.eff_factors, name );
+    double eff_fac = args.eff_factors.front();
     double concentration = polymer
                            ? well->getPolymerProperties( args.sim_step ).m_polymerConcentration
                            : 1;
@@ -366,20 +548,20 @@ inline quantity bhp( const fn_args& args ) {
     const quantity zero = { 0, measure::pressure };
     if( args.schedule_wells.empty() ) return zero;
 
-    const auto p = args.wells.find( args.schedule_wells.front()->name() );
-    if( p == args.wells.end() ) return zero;
+    const auto* p = well_result( args, 0 );
+    if( !p ) return zero;
 
-    return { p->second.bhp, measure::pressure };
+    return { p->bhp, measure::pressure };
 }
 
 inline quantity thp( const fn_args& args ) {
     const quantity zero = { 0, measure::pressure };
     if( args.schedule_wells.empty() ) return zero;
 
-    const auto p = args.wells.find( args.schedule_wells.front()->name() );
-    if( p == args.wells.end() ) return zero;
+    const auto* p = well_result( args, 0 );
+    if( !p ) return zero;
 
-    return { p->second.thp, measure::pressure };
+    return { p->thp, measure::pressure };
 }
 
 inline quantity bhp_history( const fn_args& args ) {
@@ -420,9 +602,10 @@ inline quantity production_history( const fn_args& args ) {
      */
 
     double sum = 0.0;
-    for( const Well* sched_well : args.schedule_wells ){
+    for( size_t well = 0; well < args.schedule_wells.size(); ++well ){
 
-        double eff_fac = efac( args.eff_factors, sched_well->name() );
+        const Well* sched_well = args.schedule_wells[ well ];
+        double eff_fac = args.eff_factors[ well ];
         sum += sched_well->production_rate( phase, args.sim_step ) * eff_fac;
     }
 
@@ -434,9 +617,10 @@ template< Phase phase >
 inline quantity injection_history( const fn_args& args ) {
 
     double sum = 0.0;
-    for( const Well* sched_well : args.schedule_wells ){
+    for( size_t well = 0; well < args.schedule_wells.size(); ++well ){
 
-        double eff_fac = efac( args.eff_factors, sched_well->name() );
+        const Well* sched_well = args.schedule_wells[ well ];
+        double eff_fac = args.eff_factors[ well ];
         sum += sched_well->injection_rate( phase, args.sim_step ) * eff_fac;
     }
 
@@ -476,16 +660,41 @@ inline quantity duration( const fn_args& args ) {
     return { args.duration, measure::time };
 }
 
+/*
+ * The results of a well usually hold the connections in the order of the
+ * schedule, so the schedule position is tried before searching.
+ */
+inline const data::Connection* find_connection( const data::Well& result,
+                                                const out::RegionCache::Connection& connection ) {
+    const auto& connections = result.connections;
+    if( connection.connection < connections.size()
+        && connections[ connection.connection ].index == connection.active_index )
+        return &connections[ connection.connection ];
+
+    const auto iter = std::find_if( connections.begin(),
+                                    connections.end(),
+                                    [&]( const data::Connection& c ) {
+                                        return c.index == connection.active_index;
+                                    } );
+    if( iter == connections.end() ) return nullptr;
+
+    return &*iter;
+}
+
 template<rt phase , bool injection>
 quantity region_rate( const fn_args& args ) {
     double sum = 0;
-    const auto& well_connections = args.regionCache.connections( args.num );
+    const auto well_connections = args.regionCache.connections( args.num, args.sim_step );
 
-    for (const auto& pair : well_connections) {
+    for (size_t conn = 0; conn < well_connections.size(); ++conn) {
+        const size_t well = args.connection_wells[ conn ];
+        const auto* result = well_result( args, well );
+        if( !result ) continue;
 
-        double eff_fac = efac( args.eff_factors, pair.first );
+        const auto* connection = find_connection( *result, well_connections[ conn ] );
+        if( !connection ) continue;
 
-        double rate = args.wells.get( pair.first , pair.second , phase ) * eff_fac;
+        double rate = connection->rates.get( phase, 0.0 ) * args.eff_factors[ well ];
 
         // We are asking for the production rate in an injector - or
         // opposite. We just clamp to zero.
@@ -879,18 +1088,16 @@ inline std::vector< const Well* > find_wells( const Schedule& schedule,
 
     if( type == ECL_SMSPEC_REGION_VAR ) {
         std::vector< const Well* > wells;
+        std::unordered_set< const Well* > seen;
 
         const auto region = smspec_node_get_num( node );
 
-        for ( const auto& connection : regionCache.connections( region ) ){
-            const auto& w_name = connection.first;
-            const auto& well = schedule.getWell( w_name );
+        const auto& all_wells = schedule.getWells();
+        for ( const auto& connection : regionCache.connections( region, sim_step ) ){
+            const auto* well = all_wells[ connection.well ];
 
-            const auto& it = std::find_if( wells.begin(), wells.end(),
-                                           [&] ( const Well* elem )
-                                           { return *elem == *well; });
-            if ( it == wells.end() )
-                wells.push_back( schedule.getWell( w_name ) );
+            if ( seen.insert( well ).second )
+                wells.push_back( well );
         }
 
         return wells;
@@ -899,6 +1106,24 @@ inline std::vector< const Well* > find_wells( const Schedule& schedule,
     return {};
 }
 
+/*
+ * The evaluation plan of one summary vector: the wells it covers with their
+ * efficiency factors, the position of each well in the dense array of well
+ * results, and for region vectors which of the wells each of the region
+ * connections belongs to. Group and field vectors are evaluated from the
+ * rolled up well rates. The plans only depend on the schedule, and are
+ * compiled once per report step.
+ */
+struct node_plan {
+    std::vector< const Well* > wells;
+    std::vector< size_t > well_index;
+    std::vector< double > eff_factors;
+    std::vector< size_t > connection_wells;
+    bool rollup = false;
+    int group = -1;
+    double group_factor = 1.0;
+};
+
 }
 
 namespace out {
@@ -907,9 +1132,28 @@ class Summary::keyword_handlers {
     public:
         using fn = ofun;
         std::vector< std::pair< smspec_node_type*, fn > > handlers;
-        std::map< std::string, smspec_node_type* > single_value_nodes;
-        std::map< std::pair <std::string, int>, smspec_node_type* > region_nodes;
-        std::map< std::pair <std::string, int>, smspec_node_type* > block_nodes;
+
+        // The ids in the SummaryState of the vectors of the handlers, and
+        // of the single, region and block values passed to add_timestep().
+        std::vector< size_t > handler_ids;
+        std::map< std::string, size_t > single_value_ids;
+        std::map< std::pair <std::string, int>, size_t > region_ids;
+        std::map< std::pair <std::string, int>, size_t > block_ids;
+
+        // Evaluation plans for the entries in handlers, compiled for
+        // plan_step, and the well results of the current time step indexed
+        // by the position of the well in Schedule::getWells().
+        std::vector< node_plan > plans;
+        const Schedule* plan_schedule = nullptr;
+        int plan_step = -1;
+        std::unordered_map< std::string, size_t > result_index;
+        std::vector< const data::Well* > well_results;
+        well_rollup rollup;
+
+        // Position of the summary vectors in the PARAMS array of the
+        // native SummaryWriter, indexed by SummaryState id; -1 for the
+        // vectors which are not written.
+        std::vector< int > param_index;
 
         // Memory management for restart-related summary vectors
         // that are not requested in SUMMARY section.
@@ -965,6 +1209,42 @@ Summary::Summary( const EclipseState& st,
                                                  st.getInputGrid().getNY(),
                                                  st.getInputGrid().getNZ()));
 
+    /*
+      Unformatted summary files are written by the native SummaryWriter,
+      which appends every time step to the summary data file; the ecl_sum
+      instance is then only used to hold the summary vector nodes. The
+      formatted files are still written with ecl_sum_fwrite().
+    */
+    if (!st.getIOConfig().getFMTOUT())
+        this->writer.reset( new SummaryWriter( basename,
+                                               st.getIOConfig().getUNIFOUT(),
+                                               schedule.posixStartTime(),
+                                               st.getInputGrid().getNX(),
+                                               st.getInputGrid().getNY(),
+                                               st.getInputGrid().getNZ(),
+                                               st.getUnits().getEclType(),
+                                               restart_case ? restart_case : "",
+                                               restart_step ) );
+
+    auto add_var = [this]( const char* keyword, const char* wgname, int num, const char* unit ) {
+        auto* nodeptr = ecl_sum_add_var( this->ecl_sum.get(), keyword, wgname, num, unit, 0 );
+        const auto id = this->prev_state.add_key( smspec_node_get_gen_key1( nodeptr ) );
+
+        if (this->writer) {
+            auto& param_index = this->handlers->param_index;
+            param_index.resize( this->prev_state.size(), -1 );
+            param_index[ id ] = this->writer->addVector( keyword,
+                                                         wgname ? wgname : "",
+                                                         num,
+                                                         unit );
+        }
+        return nodeptr;
+    };
+
+    const auto state_id = [this]( const smspec_node_type* nodeptr ) {
+        return this->prev_state.key_id( smspec_node_get_gen_key1( nodeptr ) );
+    };
+
     /* register all keywords handlers and pair with the newly-registered ert
      * entry.
      */
@@ -990,24 +1270,20 @@ Summary::Summary( const EclipseState& st,
                 continue;
             }
 
-            auto* nodeptr = ecl_sum_add_var( this->ecl_sum.get(),
-                                             keyword,
-                                             node.wgname(),
-                                             node.num(),
-                                             st.getUnits().name( single_value_pair->second ),
-                                             0 );
+            auto* nodeptr = add_var( keyword,
+                                    node.wgname(),
+                                    node.num(),
+                                    st.getUnits().name( single_value_pair->second ) );
 
-            this->handlers->single_value_nodes.emplace( keyword, nodeptr );
+            this->handlers->single_value_ids.emplace( keyword, state_id( nodeptr ) );
         } else if (region_pair != region_units.end()) {
 
-            auto* nodeptr = ecl_sum_add_var( this->ecl_sum.get(),
-                                             keyword,
-                                             node.wgname(),
-                                             node.num(),
-                                             st.getUnits().name( region_pair->second ),
-                                             0 );
+            auto* nodeptr = add_var( keyword,
+                                    node.wgname(),
+                                    node.num(),
+                                    st.getUnits().name( region_pair->second ) );
 
-            this->handlers->region_nodes.emplace( std::make_pair(keyword, node.num()), nodeptr );
+            this->handlers->region_ids.emplace( std::make_pair(keyword, node.num()), state_id( nodeptr ) );
 
         } else if (block_pair != block_units.end()) {
             if (node.type() != ECL_SMSPEC_BLOCK_VAR)
@@ -1017,14 +1293,12 @@ Summary::Summary( const EclipseState& st,
             if (!this->grid.cellActive(global_index))
                 continue;
 
-            auto* nodeptr = ecl_sum_add_var( this->ecl_sum.get(),
-                                             keyword,
-                                             node.wgname(),
-                                             node.num(),
-                                             st.getUnits().name( block_pair->second ),
-                                             0 );
+            auto* nodeptr = add_var( keyword,
+                                    node.wgname(),
+                                    node.num(),
+                                    st.getUnits().name( block_pair->second ) );
 
-            this->handlers->block_nodes.emplace( std::make_pair(keyword, node.num()), nodeptr );
+            this->handlers->block_ids.emplace( std::make_pair(keyword, node.num()), state_id( nodeptr ) );
 
 
 
@@ -1044,19 +1318,22 @@ Summary::Summary( const EclipseState& st,
                                     0,           // Duration of time step
                                     0,           // Simulation step
                                     node.num(),  // NUMS value for the summary output.
-                                    {},          // Well results - data::Wells
+                                    {},          // Position of the wells in the well results
+                                    {},          // Well results - data::Well
                                     {},          // Region <-> cell mappings.
                                     this->grid,
-                                    {}};
+                                    {},          // Well efficiency factors
+                                    {},          // Wells of the region connections
+                                    nullptr,     // Rolled up group and field rates
+                                    -1,          // Group id
+                                    1.0 };       // Group efficiency factor
 
             const auto val = handle( no_args );
 
-            auto* nodeptr = ecl_sum_add_var( this->ecl_sum.get(),
-                                             keyword,
-                                             node.wgname(),
-                                             node.num(),
-                                             st.getUnits().name( val.unit ),
-                                             0 );
+            auto* nodeptr = add_var( keyword,
+                                    node.wgname(),
+                                    node.num(),
+                                    st.getUnits().name( val.unit ) );
 
             this->handlers->handlers.emplace_back( nodeptr, handle );
         } else {
@@ -1099,9 +1376,17 @@ Summary::Summary( const EclipseState& st,
 
     for (const auto& pair : this->handlers->handlers) {
         const auto * nodeptr = pair.first;
+        const auto id = this->prev_state.add_key(smspec_node_get_gen_key1(nodeptr));
+
+        this->handlers->handler_ids.push_back(id);
         if (smspec_node_is_total(nodeptr))
-            this->prev_state.add(smspec_node_get_gen_key1(nodeptr), 0);
+            this->prev_state.set(id, 0);
     }
+
+    // The two states are swapped after every time step; they share the
+    // key ids.
+    this->handlers->param_index.resize( this->prev_state.size(), -1 );
+    this->state = this->prev_state;
 }
 
 /*
@@ -1120,12 +1405,12 @@ Summary::Summary( const EclipseState& st,
  * rates and accumulated values.
  *
  */
-std::vector< std::pair< std::string, double > >
+std::vector< double >
 well_efficiency_factors( const smspec_node_type* type,
                     const Schedule& schedule,
                     const std::vector< const Well* >& schedule_wells,
                     const int sim_step ) {
-    std::vector< std::pair< std::string, double > > efac;
+    std::vector< double > efac( schedule_wells.size(), 1.0 );
 
     if(    smspec_node_get_var_type(type) != ECL_SMSPEC_GROUP_VAR
         && smspec_node_get_var_type(type) != ECL_SMSPEC_FIELD_VAR
@@ -1138,32 +1423,85 @@ well_efficiency_factors( const smspec_node_type* type,
     const bool is_rate = !smspec_node_is_total( type );
     const auto &groupTree = schedule.getGroupTree(sim_step);
 
-    for( const auto* well : schedule_wells ) {
+    for( size_t index = 0; index < schedule_wells.size(); ++index ) {
+        const auto* well = schedule_wells[ index ];
         double eff_factor = well->getEfficiencyFactor(sim_step);
 
         if ( !well->hasBeenDefined( sim_step ) )
             continue;
 
-        const auto* node = &schedule.getGroup(well->getGroupName(sim_step));
+        int node_id = groupTree.groupId( well->getGroupName(sim_step) );
 
-        while(true){
+        while( node_id >= 0 ) {
+            const auto& node = schedule.getGroup( groupTree.groupName( node_id ) );
             if((   is_group
                 && is_rate
-                && node->name() == smspec_node_get_wgname(type) ))
+                && node.name() == smspec_node_get_wgname(type) ))
                 break;
-            eff_factor *= node->getGroupEfficiencyFactor( sim_step );
+            eff_factor *= node.getGroupEfficiencyFactor( sim_step );
 
-            const auto& parent = groupTree.parent( node->name() );
-            if( !schedule.hasGroup( parent ) )
-                break;
-            node = &schedule.getGroup( parent );
+            node_id = groupTree.parentId( node_id );
         }
-        efac.emplace_back( well->name(), eff_factor );
+        efac[ index ] = eff_factor;
     }
 
     return efac;
 }
 
+void Summary::compile_plans( const Schedule& schedule, int sim_step ) {
+    auto& result_index = this->handlers->result_index;
+    const auto& all_wells = schedule.getWells();
+
+    result_index.clear();
+    for( size_t index = 0; index < all_wells.size(); ++index )
+        result_index.emplace( all_wells[ index ]->name(), index );
+
+    this->handlers->well_results.assign( all_wells.size(), nullptr );
+    this->handlers->rollup.compile( schedule, sim_step, result_index );
+
+    const auto& tree = schedule.getGroupTree( sim_step );
+
+    auto& plans = this->handlers->plans;
+    plans.clear();
+    plans.reserve( this->handlers->handlers.size() );
+
+    for( const auto& f : this->handlers->handlers ) {
+        node_plan plan;
+
+        plan.wells = find_wells( schedule, f.first, sim_step, this->regionCache );
+        plan.eff_factors = well_efficiency_factors( f.first, schedule, plan.wells, sim_step );
+
+        for( const auto* well : plan.wells )
+            plan.well_index.push_back( result_index.at( well->name() ) );
+
+        const auto type = smspec_node_get_var_type( f.first );
+        if( type == ECL_SMSPEC_FIELD_VAR )
+            plan.rollup = true;
+
+        if( type == ECL_SMSPEC_GROUP_VAR && tree.exists( smspec_node_get_wgname( f.first ) ) ) {
+            plan.rollup = true;
+            plan.group = tree.groupId( smspec_node_get_wgname( f.first ) );
+            if( smspec_node_is_total( f.first ) )
+                plan.group_factor = this->handlers->rollup.total_factor( plan.group );
+        }
+
+        if( type == ECL_SMSPEC_REGION_VAR ) {
+            std::unordered_map< const Well*, size_t > position;
+            for( size_t index = 0; index < plan.wells.size(); ++index )
+                position.emplace( plan.wells[ index ], index );
+
+            const auto region = smspec_node_get_num( f.first );
+            for( const auto& connection : this->regionCache.connections( region, sim_step ) )
+                plan.connection_wells.push_back( position.at( all_wells[ connection.well ] ) );
+        }
+
+        plans.push_back( std::move( plan ) );
+    }
+
+    this->handlers->plan_schedule = &schedule;
+    this->handlers->plan_step = sim_step;
+}
+
 void Summary::add_timestep( int report_step,
                             double secs_elapsed,
                             const EclipseState& es,
@@ -1173,9 +1511,14 @@ void Summary::add_timestep( int report_step,
                             const std::map<std::string, std::vector<double>>& region_values,
                             const std::map<std::pair<std::string, int>, double>& block_values) {
 
-    auto* tstep = ecl_sum_add_tstep( this->ecl_sum.get(), report_step, secs_elapsed );
+    ecl_sum_tstep_type* tstep = nullptr;
+    if (this->writer)
+        this->writer->addTimestep( report_step, secs_elapsed / unit::day );
+    else
+        tstep = ecl_sum_add_tstep( this->ecl_sum.get(), report_step, secs_elapsed );
     const double duration = secs_elapsed - this->prev_time_elapsed;
-    SummaryState st;
+    auto& st = this->state;
+    st.reset();
 
     /* report_step is the number of the file we are about to write - i.e. for instance CASE.S$report_step
      * for the data in a non-unified summary file.
@@ -1183,86 +1526,104 @@ void Summary::add_timestep( int report_step,
      * necessary to use when consulting the Schedule object. */
     const auto sim_step = std::max( 0, report_step - 1 );
 
-    for( auto& f : this->handlers->handlers ) {
-        const int num = smspec_node_get_num( f.first );
-        const auto* genkey = smspec_node_get_gen_key1( f.first );
+    if( sim_step != this->handlers->plan_step || &schedule != this->handlers->plan_schedule )
+        this->compile_plans( schedule, sim_step );
+
+    auto& well_results = this->handlers->well_results;
+    std::fill( well_results.begin(), well_results.end(), nullptr );
+    this->handlers->rollup.clear();
+    for( const auto& well : wells ) {
+        const auto index = this->handlers->result_index.find( well.first );
+        if( index != this->handlers->result_index.end() )
+            well_results[ index->second ] = &well.second;
+    }
 
-        const auto schedule_wells = find_wells( schedule, f.first, sim_step, this->regionCache );
-        auto eff_factors = well_efficiency_factors( f.first, schedule, schedule_wells, sim_step );
+    for( size_t node = 0; node < this->handlers->handlers.size(); ++node ) {
+        const auto& f = this->handlers->handlers[ node ];
+        const auto& plan = this->handlers->plans[ node ];
+        const int num = smspec_node_get_num( f.first );
+        const auto id = this->handlers->handler_ids[ node ];
 
-        const auto val = f.second( { schedule_wells,
+        const auto val = f.second( { plan.wells,
                                      duration,
                                      sim_step,
                                      num,
-                                     wells,
+                                     plan.well_index,
+                                     well_results,
                                      this->regionCache,
                                      this->grid,
-                                     eff_factors});
+                                     plan.eff_factors,
+                                     plan.connection_wells,
+                                     plan.rollup ? &this->handlers->rollup : nullptr,
+                                     plan.group,
+                                     plan.group_factor });
 
         double unit_applied_val = es.getUnits().from_si( val.unit, val.value );
         if (smspec_node_is_total(f.first))
-            unit_applied_val += this->prev_state.get(genkey);
+            unit_applied_val += this->prev_state.get(id);
 
-        st.add(genkey, unit_applied_val);
+        st.set(id, unit_applied_val);
     }
 
     for( const auto& value_pair : single_values ) {
         const std::string key = value_pair.first;
-        const auto node_pair = this->handlers->single_value_nodes.find( key );
-        if (node_pair != this->handlers->single_value_nodes.end()) {
-            const auto * nodeptr = node_pair->second;
-            const auto * genkey = smspec_node_get_gen_key1( nodeptr );
+        const auto id_pair = this->handlers->single_value_ids.find( key );
+        if (id_pair != this->handlers->single_value_ids.end()) {
             const auto unit = single_values_units.at( key );
             double si_value = value_pair.second;
             double output_value = es.getUnits().from_si(unit , si_value );
-            st.add(genkey, output_value);
+            st.set(id_pair->second, output_value);
         }
     }
 
     for( const auto& value_pair : region_values ) {
         const std::string key = value_pair.first;
         for (size_t reg = 0; reg < value_pair.second.size(); ++reg) {
-            const auto node_pair = this->handlers->region_nodes.find( std::make_pair(key, reg+1) );
-            if (node_pair != this->handlers->region_nodes.end()) {
-                const auto * nodeptr = node_pair->second;
-                const auto* genkey = smspec_node_get_gen_key1( nodeptr );
+            const auto id_pair = this->handlers->region_ids.find( std::make_pair(key, reg+1) );
+            if (id_pair != this->handlers->region_ids.end()) {
                 const auto unit = region_units.at( key );
-
-                assert (smspec_node_get_num( nodeptr ) - 1 == static_cast<int>(reg));
                 double si_value = value_pair.second[reg];
                 double output_value = es.getUnits().from_si(unit , si_value );
-                st.add(genkey, output_value);
+                st.set(id_pair->second, output_value);
             }
         }
     }
 
     for( const auto& value_pair : block_values ) {
         const std::pair<std::string, int> key = value_pair.first;
-        const auto node_pair = this->handlers->block_nodes.find( key );
-        if (node_pair != this->handlers->block_nodes.end()) {
-            const auto * nodeptr = node_pair->second;
-            const auto * genkey = smspec_node_get_gen_key1( nodeptr );
+        const auto id_pair = this->handlers->block_ids.find( key );
+        if (id_pair != this->handlers->block_ids.end()) {
             const auto unit = block_units.at( key.first );
             double si_value = value_pair.second;
             double output_value = es.getUnits().from_si(unit , si_value );
-            st.add(genkey, output_value);
+            st.set(id_pair->second, output_value);
         }
     }
 
-    for (const auto& pair: st) {
-        const auto* key = pair.first.c_str();
+    for (size_t id = 0; id < st.size(); ++id) {
+        if (!st.has(id))
+            continue;
 
-        if (ecl_sum_has_key(this->ecl_sum.get(), key)) {
-            ecl_sum_tstep_set_from_key(tstep, key, pair.second);
+        if (this->writer) {
+            const auto index = this->handlers->param_index[ id ];
+            if (index >= 0)
+                this->writer->set( index, st.get(id) );
+        } else {
+            const auto* key = st.key(id).c_str();
+            if (ecl_sum_has_key(this->ecl_sum.get(), key))
+                ecl_sum_tstep_set_from_key(tstep, key, st.get(id));
         }
     }
 
-    this->prev_state = st;
+    std::swap(this->state, this->prev_state);
     this->prev_time_elapsed = secs_elapsed;
 }
 
 void Summary::write() {
-    ecl_sum_fwrite( this->ecl_sum.get() );
+    if (this->writer)
+        this->writer->write();
+    else
+        ecl_sum_fwrite( this->ecl_sum.get() );
 }
 
 Summary::~Summary() {}
@@ -18,35 +18,129 @@
 */
 
 
+#include <algorithm>
+#include <stdexcept>
+
 #include <opm/output/eclipse/SummaryState.hpp>
 
 namespace Opm{
 
+    SummaryState::const_iterator::const_iterator(const SummaryState& state_arg, size_t id_arg) :
+        state(&state_arg),
+        id(id_arg)
+    {
+        while (this->id < this->state->size() && !this->state->defined[this->id])
+            ++this->id;
+    }
+
+
+    SummaryState::const_iterator::value_type SummaryState::const_iterator::operator*() const {
+        return { this->state->keys[this->id], this->state->values[this->id] };
+    }
+
+
+    SummaryState::const_iterator& SummaryState::const_iterator::operator++() {
+        ++this->id;
+        while (this->id < this->state->size() && !this->state->defined[this->id])
+            ++this->id;
+
+        return *this;
+    }
+
+
+    bool SummaryState::const_iterator::operator==(const const_iterator& other) const {
+        return this->state == other.state && this->id == other.id;
+    }
+
+
+    bool SummaryState::const_iterator::operator!=(const const_iterator& other) const {
+        return !(*this == other);
+    }
+
+
+    size_t SummaryState::add_key(const std::string& key) {
+        const auto iter = this->ids.find(key);
+        if (iter != this->ids.end())
+            return iter->second;
+
+        const size_t id = this->keys.size();
+        this->ids.emplace(key, id);
+        this->keys.push_back(key);
+        this->values.push_back(0);
+        this->defined.push_back(false);
+        return id;
+    }
+
+
+    size_t SummaryState::key_id(const std::string& key) const {
+        const auto iter = this->ids.find(key);
+        if (iter == this->ids.end())
+            throw std::invalid_argument("XX No such key: " + key);
+
+        return iter->second;
+    }
+
+
+    const std::string& SummaryState::key(size_t id) const {
+        return this->keys.at(id);
+    }
+
+
+    size_t SummaryState::size() const {
+        return this->keys.size();
+    }
+
+
+    void SummaryState::set(size_t id, double value) {
+        this->values[id] = value;
+        this->defined[id] = true;
+    }
+
+
+    double SummaryState::get(size_t id) const {
+        if (!this->has(id))
+            throw std::invalid_argument("XX No value for key: " + this->key(id));
+
+        return this->values[id];
+    }
+
+
+    bool SummaryState::has(size_t id) const {
+        return id < this->defined.size() && this->defined[id];
+    }
+
+
+    void SummaryState::reset() {
+        std::fill(this->defined.begin(), this->defined.end(), false);
+    }
+
+
     void SummaryState::add(const std::string& key, double value) {
-        this->values[key] = value;
+        this->set(this->add_key(key), value);
     }
 
 
     bool SummaryState::has(const std::string& key) const {
-        return (this->values.find(key) != this->values.end());
+        const auto iter = this->ids.find(key);
+        return iter != this->ids.end() && this->defined[iter->second];
     }
 
 
     double SummaryState::get(const std::string& key) const {
-        const auto iter = this->values.find(key);
-        if (iter == this->values.end())
+        const auto iter = this->ids.find(key);
+        if (iter == this->ids.end() || !this->defined[iter->second])
             throw std::invalid_argument("XX No such key: " + key);
 
-        return iter->second;
+        return this->values[iter->second];
     }
 
     SummaryState::const_iterator SummaryState::begin() const {
-        return this->values.begin();
+        return const_iterator(*this, 0);
     }
 
 
     SummaryState::const_iterator SummaryState::end() const {
-        return this->values.end();
+        return const_iterator(*this, this->size());
     }
 
 }
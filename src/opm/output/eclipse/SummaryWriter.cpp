@@ -0,0 +1,189 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstdio>
+#include <ctime>
+#include <stdexcept>
+
+#include <opm/output/eclipse/EclOutput.hpp>
+#include <opm/output/eclipse/SummaryWriter.hpp>
+
+namespace Opm { namespace out {
+
+namespace {
+
+    const size_t char_length  = 8;
+    const size_t restart_size = 8;
+    const int    simulator_id = 100;
+
+    const char* const dummy_wgname = ":+:+:+:+";
+
+}
+
+SummaryWriter::SummaryWriter( const std::string& basename_arg,
+                              bool unified_arg,
+                              std::time_t start_time_arg,
+                              int nx, int ny, int nz,
+                              int unit_type_arg,
+                              const std::string& restart_case_arg,
+                              int restart_step_arg ) :
+    basename( basename_arg ),
+    unified( unified_arg ),
+    start_time( start_time_arg ),
+    dims{ nx, ny, nz },
+    unit_type( unit_type_arg ),
+    restart_case( restart_case_arg ),
+    restart_step( restart_step_arg )
+{
+    this->addVector( "TIME", "", 0, "DAYS" );
+}
+
+SummaryWriter::~SummaryWriter() = default;
+
+size_t SummaryWriter::addVector( const std::string& keyword,
+                                 const std::string& wgname,
+                                 int num,
+                                 const std::string& unit ) {
+    this->keywords.push_back( keyword );
+    this->wgnames.push_back( wgname.empty() ? dummy_wgname : wgname );
+    this->nums.push_back( num );
+    this->units.push_back( unit );
+    this->specification_written = false;
+
+    if( this->step_open )
+        this->params.resize( this->keywords.size(), 0.0 );
+
+    return this->keywords.size() - 1;
+}
+
+size_t SummaryWriter::size() const {
+    return this->keywords.size();
+}
+
+void SummaryWriter::addTimestep( int report_step_arg, double days ) {
+    this->closeStep();
+
+    /*
+      In the non-unified format every report step has its own file, the
+      file of the previous report step is completed when it is closed.
+    */
+    if( report_step_arg != this->report_step ) {
+        this->openDataFile( report_step_arg );
+        this->data_file->write( "SEQHDR", std::vector< int >{ 0 } );
+    }
+
+    this->report_step = report_step_arg;
+    this->ministep += 1;
+    this->params.assign( this->keywords.size(), 0.0 );
+    this->params[ 0 ] = days;
+    this->step_open = true;
+}
+
+void SummaryWriter::set( size_t index, float value ) {
+    if( !this->step_open )
+        throw std::logic_error( "Summary vectors can only be set after addTimestep()" );
+
+    this->params.at( index ) = value;
+}
+
+void SummaryWriter::closeStep() {
+    if( !this->step_open )
+        return;
+
+    this->data_file->write( "MINISTEP", std::vector< int >{ this->ministep } );
+    this->data_file->write( "PARAMS", this->params );
+    this->step_open = false;
+}
+
+void SummaryWriter::write() {
+    this->closeStep();
+
+    if( !this->specification_written )
+        this->writeSpecification();
+
+    if( !this->data_file )
+        return;
+
+    this->writes_since_flush += 1;
+    if( this->flush_interval > 0 && this->writes_since_flush >= this->flush_interval )
+        this->flush();
+}
+
+void SummaryWriter::flush() {
+    if( this->data_file )
+        this->data_file->flush();
+
+    this->writes_since_flush = 0;
+}
+
+void SummaryWriter::setFlushInterval( size_t flush_interval_arg ) {
+    this->flush_interval = flush_interval_arg;
+}
+
+void SummaryWriter::openDataFile( int step ) {
+    if( this->data_file && this->unified )
+        return;
+
+    std::string filename = this->basename;
+    if( this->unified )
+        filename += ".UNSMRY";
+    else {
+        char extension[ 16 ];
+        std::snprintf( extension, sizeof( extension ), ".S%04d", step );
+        filename += extension;
+    }
+
+    if( this->data_file )
+        this->data_file->close();
+
+    this->data_file.reset( new EclOutput( filename ) );
+}
+
+void SummaryWriter::writeSpecification() {
+    std::vector< std::string > restart( restart_size );
+    for( size_t index = 0; index < restart_size; ++index ) {
+        const auto start = index * char_length;
+        if( start < this->restart_case.size() )
+            restart[ index ] = this->restart_case.substr( start, char_length );
+    }
+
+    const auto start_date = *std::gmtime( &this->start_time );
+
+    EclOutput spec( this->basename + ".SMSPEC" );
+    spec.write( "INTEHEAD", std::vector< int >{ this->unit_type, simulator_id } );
+    spec.write( "RESTART", restart );
+    spec.write( "DIMENS", std::vector< int >{ static_cast< int >( this->keywords.size() ),
+                                              this->dims[ 0 ], this->dims[ 1 ], this->dims[ 2 ],
+                                              0, this->restart_step } );
+    spec.write( "KEYWORDS", this->keywords );
+    spec.write( "WGNAMES", this->wgnames );
+    spec.write( "NUMS", this->nums );
+    spec.write( "UNITS", this->units );
+    spec.write( "STARTDAT", std::vector< int >{ start_date.tm_mday,
+                                                start_date.tm_mon + 1,
+                                                start_date.tm_year + 1900,
+                                                start_date.tm_hour,
+                                                start_date.tm_min,
+                                                start_date.tm_sec * 1000000 } );
+    spec.close();
+
+    this->specification_written = true;
+}
+
+}}
@@ -18,6 +18,7 @@
  */
 
 #include <opm/output/eclipse/Tables.hpp>
+#include <opm/output/eclipse/EclOutput.hpp>
 
 #include <ert/ecl/FortIO.hpp>
 #include <ert/ecl/EclKW.hpp>
@@ -40,6 +41,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <exception>
 #include <iterator>
 #include <vector>
 
@@ -82,7 +84,9 @@ namespace { namespace SatFunc {
         ///
         /// \param[in] buildDeps Function object that implements the
         ///    protocol outlined for \code BuildDependent::operator()()
-        ///    \endcode.  Typically a lambda expression.
+        ///    \endcode.  Typically a lambda expression.  Invoked
+        ///    concurrently for different tables, so must not modify any
+        ///    shared state other than the columns of its own table.
         ///
         /// \return Linearised, padded TAB vector entries for a collection
         ///    of tabulated saturation functions corresponding to a single
@@ -97,29 +101,46 @@ namespace { namespace SatFunc {
             const auto numPrim = std::size_t{1};
             const auto numCols = 1 + 2*numDep;
 
-            auto descr = ::Opm::DifferentiateOutputTable::Descriptor{};
-            descr.primID = 0 * numPrim;
-
             auto linTable = ::Opm::LinearisedOutputTable {
                 numTab, numPrim, numRows, numCols
             };
 
-            for (descr.tableID = 0*numTab;
-                 descr.tableID < 1*numTab; ++descr.tableID)
-            {
-                descr.numActRows =
-                    buildDeps(descr.tableID, descr.primID, linTable);
-
-                // Derivatives.  Use values already stored in linTable to
-                // take advantage of any unit conversion already applied.
-                // We don't have to do anything special for the units here.
-                //
-                // Note: argument 'descr' implies argument-dependent lookup
-                //    whence we unambiguously invoke function calcSlopes()
-                //    from namespace ::Opm::DifferentiateOutputTable.
-                calcSlopes(numDep, descr, linTable);
+            // The tables are independent and write disjoint columns of
+            // linTable, so they are linearised in parallel.  Exceptions
+            // must not escape the parallel region; the first one is
+            // rethrown once all tables have been processed.
+            const auto numTables = static_cast<long>(numTab);
+            auto error = std::exception_ptr{};
+
+#pragma omp parallel for schedule(static)
+            for (long tableID = 0; tableID < numTables; ++tableID) {
+                try {
+                    auto descr = ::Opm::DifferentiateOutputTable::Descriptor{};
+                    descr.tableID = tableID;
+                    descr.primID  = 0 * numPrim;
+
+                    descr.numActRows =
+                        buildDeps(descr.tableID, descr.primID, linTable);
+
+                    // Derivatives.  Use values already stored in linTable
+                    // to take advantage of any unit conversion already
+                    // applied.  We don't have to do anything special for
+                    // the units here.
+                    //
+                    // Note: argument 'descr' implies argument-dependent
+                    //    lookup whence we unambiguously invoke function
+                    //    calcSlopes() from namespace
+                    //    ::Opm::DifferentiateOutputTable.
+                    calcSlopes(numDep, descr, linTable);
+                }
+                catch (...) {
+#pragma omp critical
+                    if (! error) { error = std::current_exception(); }
+                }
             }
 
+            if (error) { std::rethrow_exception(error); }
+
             return linTable.getDataDestructively();
         }
     } // detail
@@ -186,13 +207,10 @@ namespace { namespace SatFunc {
                 {
                     const auto uPress = ::Opm::UnitSystem::measure::pressure;
 
-                    const auto& pc = t.getPcogColumn();
-                    std::transform(std::begin(pc), std::end(pc),
-                                   linTable.column(tableID, primID, 2),
-                                   [&units, uPress](const double Pc) -> double
-                                   {
-                                       return units.from_si(uPress, Pc);
-                                   });
+                    auto pc = t.getPcogColumn().vectorCopy();
+                    units.from_si(uPress, pc);
+                    std::copy(std::begin(pc), std::end(pc),
+                              linTable.column(tableID, primID, 2));
                 }
 
                 // Inform createSatfuncTable() of number of active rows in
@@ -261,13 +279,10 @@ namespace { namespace SatFunc {
                 {
                     const auto uPress = ::Opm::UnitSystem::measure::pressure;
 
-                    const auto& pc = t.getPcogColumn();
-                    std::transform(std::begin(pc), std::end(pc),
-                                   linTable.column(tableID, primID, 2),
-                                   [&units, uPress](const double Pc) -> double
-                                   {
-                                       return units.from_si(uPress, Pc);
-                                   });
+                    auto pc = t.getPcogColumn().vectorCopy();
+                    units.from_si(uPress, pc);
+                    std::copy(std::begin(pc), std::end(pc),
+                              linTable.column(tableID, primID, 2));
                 }
 
                 // Inform createSatfuncTable() of number of active rows in
@@ -557,20 +572,37 @@ namespace { namespace SatFunc {
                     auto e = std::end  (this->s_);
                     auto p = std::lower_bound(b, e, s);
 
-                    if (p == b) { return this->kro_.front(); }
-                    if (p == e) { return this->kro_.back (); }
-
-                    const auto i = p - b; // *Right-hand* end-point.
-
-                    const auto sl = this->s_  [i - 1];
-                    const auto yl = this->kro_[i - 1];
+                    return this->interpolate(s, p - b);
+                }
 
-                    const auto sr = this->s_  [i - 0];
-                    const auto yr = this->kro_[i - 0];
+                /// Get relative permeability for oil at a sequence of
+                /// increasing oil saturations.
+                ///
+                /// Equivalent to Kro(So), but the look-up continues from
+                /// the position of the previous call instead of searching
+                /// the whole table.  Merging a table of increasing oil
+                /// saturations is thereby linear in the table sizes.
+                ///
+                /// \param[in] So Oil saturation.  Must not be less than
+                ///   the oil saturation of the previous call using the
+                ///   same \p pos.
+                ///
+                /// \param[in,out] pos Look-up position.  Initialise to
+                ///   size() before the first call.
+                ///
+                /// \return Relative permeability for oil at So.
+                double Kro(const double So, std::size_t& pos) const
+                {
+                    const auto s = this->So_off_ - So;
 
-                    const auto t = (s - sl) / (sr - sl);
+                    // Phase saturation s is non-increasing between calls
+                    // whence its std::lower_bound() position only moves
+                    // towards the start of the table.
+                    while ((pos > 0) && !(this->s_[pos - 1] < s)) {
+                        --pos;
+                    }
 
-                    return t*yr + (1.0 - t)*yl;
+                    return this->interpolate(s, pos);
                 }
 
                 /// Retrieve number of active saturation nodes in this
@@ -590,6 +622,30 @@ namespace { namespace SatFunc {
                 /// Oil saturation offset through which to convert between
                 /// input phase saturation and oil saturation.
                 double So_off_;
+
+                /// Piecewise linear interpolation of KrO at phase
+                /// saturation \p s.
+                ///
+                /// \param[in] s Phase saturation.
+                ///
+                /// \param[in] i Position of std::lower_bound() of \p s in
+                ///   the phase saturation table.
+                double interpolate(const double s, const std::size_t i) const
+                {
+                    if (i == 0)               { return this->kro_.front(); }
+                    if (i == this->s_.size()) { return this->kro_.back (); }
+
+                    // i is the *right-hand* end-point.
+                    const auto sl = this->s_  [i - 1];
+                    const auto yl = this->kro_[i - 1];
+
+                    const auto sr = this->s_  [i - 0];
+                    const auto yr = this->kro_[i - 0];
+
+                    const auto t = (s - sl) / (sr - sl);
+
+                    return t*yr + (1.0 - t)*yl;
+                }
             };
 
             /// Pair of saturation node index and saturation function table.
@@ -692,6 +748,13 @@ namespace { namespace SatFunc {
 
                 for (auto& col : ret) { col.reserve(mrg.size()); }
 
+                // Look-up positions for the "other" column.  The merged
+                // rows have increasing oil saturation, so each position
+                // only moves in one direction through its table.
+                auto pos = std::array<std::size_t, 2> {
+                    { tbl[0].size(), tbl[1].size() }
+                };
+
                 for (const auto& row : mrg) {
                     const auto self  =     row.function;
                     const auto other = 1 - row.function;
@@ -705,7 +768,7 @@ namespace { namespace SatFunc {
 
                     // 3) Assign Kro for "other" column (the one that
                     //    did not get picked for this row).
-                    ret[1 + other].push_back(tbl[other].Kro(ret[0].back()));
+                    ret[1 + other].push_back(tbl[other].Kro(ret[0].back(), pos[other]));
                 }
 
                 return ret;
@@ -913,13 +976,10 @@ namespace { namespace SatFunc {
                 {
                     const auto uPress = ::Opm::UnitSystem::measure::pressure;
 
-                    const auto& pc = t.getPcowColumn();
-                    std::transform(std::begin(pc), std::end(pc),
-                                   linTable.column(tableID, primID, 2),
-                                   [&units, uPress](const double Pc) -> double
-                                   {
-                                       return units.from_si(uPress, Pc);
-                                   });
+                    auto pc = t.getPcowColumn().vectorCopy();
+                    units.from_si(uPress, pc);
+                    std::copy(std::begin(pc), std::end(pc),
+                              linTable.column(tableID, primID, 2));
                 }
 
                 // Inform createSatfuncTable() of number of active rows in
@@ -988,13 +1048,10 @@ namespace { namespace SatFunc {
                 {
                     const auto uPress = ::Opm::UnitSystem::measure::pressure;
 
-                    const auto& pc = t.getPcowColumn();
-                    std::transform(std::begin(pc), std::end(pc),
-                                   linTable.column(tableID, primID, 2),
-                                   [&units, uPress](const double Pc) -> double
-                                   {
-                                       return units.from_si(uPress, Pc);
-                                   });
+                    auto pc = t.getPcowColumn().vectorCopy();
+                    units.from_si(uPress, pc);
+                    std::copy(std::begin(pc), std::end(pc),
+                              linTable.column(tableID, primID, 2));
                 }
 
                 // Inform createSatfuncTable() of number of active rows in
@@ -1071,20 +1128,33 @@ namespace Opm {
             size_t table_stride = dims.outer_size * composition_stride;
             size_t column_stride = table_stride * pvtoTables.size();
 
-            size_t table_index = 0;
-            for (const auto& table : pvtoTables) {
+            /*
+              The tables fill disjoint parts of pvtoData and rs_values,
+              and are converted in parallel.
+            */
+            const long num_tables = pvtoTables.size();
+#pragma omp parallel for schedule(static)
+            for (long table_index = 0; table_index < num_tables; table_index++) {
+                const auto& table = pvtoTables[table_index];
+                std::vector<double> p, mu;
                 size_t composition_index = 0;
                 for (const auto& underSatTable : table) {
-                    const auto& p  = underSatTable.getColumn("P");
+                    const auto& p_col  = underSatTable.getColumn("P");
+                    const auto& mu_col = underSatTable.getColumn("MU");
                     const auto& bo = underSatTable.getColumn("BO");
-                    const auto& mu = underSatTable.getColumn("MU");
+
+                    p.assign( p_col.begin(), p_col.end() );
+                    mu.assign( mu_col.begin(), mu_col.end() );
+
+                    this->units.from_si( UnitSystem::measure::pressure, p );
+                    this->units.from_si( UnitSystem::measure::viscosity, mu );
 
                     for (size_t row = 0; row < p.size(); row++) {
                         size_t data_index = row + composition_stride * composition_index + table_stride * table_index;
 
-                        pvtoData[ data_index ]                  = this->units.from_si( UnitSystem::measure::pressure, p[row]);
+                        pvtoData[ data_index ]                  = p[row];
                         pvtoData[ data_index + column_stride ]  = 1.0 / bo[row];
-                        pvtoData[ data_index + 2*column_stride] = this->units.from_si( UnitSystem::measure::viscosity , mu[row]) / bo[row];
+                        pvtoData[ data_index + 2*column_stride] = mu[row] / bo[row];
                     }
                     composition_index++;
                 }
@@ -1100,7 +1170,6 @@ namespace Opm {
                     for (size_t index = 0; index < rs.size(); index++)
                         rs_values[index + table_index * dims.outer_size ] = rs[index];
                 }
-                table_index++;
             }
 
             this->addData( TABDIMS_IBPVTO_OFFSET_ITEM , pvtoData );
@@ -1122,20 +1191,31 @@ namespace Opm {
             size_t table_stride = dims.outer_size * composition_stride;
             size_t column_stride = table_stride * dims.num_tables;
 
-            size_t table_index = 0;
-            for (const auto& table : pvtgTables) {
+            /*
+              The tables fill disjoint parts of pvtgData and p_values,
+              and are converted in parallel.
+            */
+            const long num_tables = pvtgTables.size();
+#pragma omp parallel for schedule(static)
+            for (long table_index = 0; table_index < num_tables; table_index++) {
+                const auto& table = pvtgTables[table_index];
+                std::vector<double> col0, col1, col2;
                 size_t composition_index = 0;
                 for (const auto& underSatTable : table) {
-                    const auto& col0 = underSatTable.getColumn(0);
-                    const auto& col1 = underSatTable.getColumn(1);
-                    const auto& col2 = underSatTable.getColumn(2);
+                    col0.assign( underSatTable.getColumn(0).begin(), underSatTable.getColumn(0).end() );
+                    col1.assign( underSatTable.getColumn(1).begin(), underSatTable.getColumn(1).end() );
+                    col2.assign( underSatTable.getColumn(2).begin(), underSatTable.getColumn(2).end() );
+
+                    this->units.from_si( UnitSystem::measure::gas_oil_ratio, col0 );
+                    this->units.from_si( UnitSystem::measure::gas_oil_ratio, col1 );
+                    this->units.from_si( UnitSystem::measure::viscosity, col2 );
 
                     for (size_t row = 0; row < col0.size(); row++) {
                         size_t data_index = row + composition_stride * composition_index + table_stride * table_index;
 
-                        pvtgData[ data_index ]                  = this->units.from_si( UnitSystem::measure::gas_oil_ratio, col0[row]);
-                        pvtgData[ data_index + column_stride ]  = this->units.from_si( UnitSystem::measure::gas_oil_ratio, col1[row]);
-                        pvtgData[ data_index + 2*column_stride] = this->units.from_si( UnitSystem::measure::viscosity , col2[row]);
+                        pvtgData[ data_index ]                  = col0[row];
+                        pvtgData[ data_index + column_stride ]  = col1[row];
+                        pvtgData[ data_index + 2*column_stride] = col2[row];
                     }
 
                     composition_index++;
@@ -1143,13 +1223,10 @@ namespace Opm {
 
                 {
                     const auto& sat_table = table.getSaturatedTable();
-                    const auto& p = sat_table.getColumn("PG");
-                    for (size_t index = 0; index < p.size(); index++)
-                        p_values[index + table_index * dims.outer_size ] =
-                            this->units.from_si( UnitSystem::measure::pressure , p[index]);
+                    auto p = sat_table.getColumn("PG").vectorCopy();
+                    this->units.from_si( UnitSystem::measure::pressure, p );
+                    std::copy( p.begin(), p.end(), p_values.begin() + table_index * dims.outer_size );
                 }
-
-                table_index++;
             }
 
             this->addData( TABDIMS_IBPVTG_OFFSET_ITEM , pvtgData );
@@ -1382,4 +1459,11 @@ namespace Opm {
             tab.fwrite(fortio);
         }
     }
+
+    void fwrite(const Tables&    tables,
+                out::EclOutput& output)
+    {
+        output.write("TABDIMS", tables.tabdims());
+        output.write("TAB", tables.tab());
+    }
 }
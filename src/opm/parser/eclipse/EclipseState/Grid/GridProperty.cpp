@@ -512,7 +512,7 @@ std::vector< double > temperature_lookup( size_t size,
             int cellEquilRegionIdx = eqlNum[cellIdx] - 1; // EQLNUM contains fortran-style indices!
             const RtempvdTable& rtempvdTable = rtempvdTables.getTable<RtempvdTable>(cellEquilRegionIdx);
             double cellDepth = std::get<2>(grid->getCellCenter(cellIdx));
-            values[cellIdx] = rtempvdTable.evaluate("Temperature", cellDepth);
+            values[cellIdx] = rtempvdTable.evaluate(RtempvdTable::Column::Temperature, cellDepth);
         }
 
         return values;
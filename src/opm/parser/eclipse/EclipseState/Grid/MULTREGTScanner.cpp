@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <stdexcept>
 #include <map>
 #include <set>
@@ -124,12 +125,12 @@ namespace Opm {
                                    std::pair(1,4) : std::tuple(TransFactor , Face , Region),
                                    ...}}
 
-      Then it will go through the different regions and looking for
-      interface with the wanted region values.
+      The search map is then compiled into one RegionLookup per region
+      array, so that getRegionMultiplier() can look up the record for a
+      (region1, region2) pair with direct indexing.
     */
     MULTREGTScanner::MULTREGTScanner(const Eclipse3DProperties& e3DProps,
-                                     const std::vector< const DeckKeyword* >& keywords) :
-                m_e3DProps(e3DProps) {
+                                     const std::vector< const DeckKeyword* >& keywords) {
 
         for (size_t idx = 0; idx < keywords.size(); idx++)
             this->addKeyword(*keywords[idx] , e3DProps.getDefaultRegionKeyword());
@@ -153,18 +154,97 @@ namespace Opm {
                               + " which is not in the deck");
         }
 
+        std::map<std::string , MULTREGTSearchMap> searchMap;
         for (auto iter = searchPairs.begin(); iter != searchPairs.end(); ++iter) {
             const MULTREGTRecord * record = (*iter).second;
             std::pair<int,int> pair = (*iter).first;
             const std::string& keyword = record->m_region.getValue();
-            if (m_searchMap.count(keyword) == 0)
-                m_searchMap[keyword] = MULTREGTSearchMap();
 
-            m_searchMap[keyword][pair] = record;
+            searchMap[keyword][pair] = record;
+        }
+
+        for (const auto& pair : searchMap) {
+            const auto& region = e3DProps.getIntGridProperty( pair.first );
+            m_nx = region.getNX();
+            m_ny = region.getNY();
+            m_lookup.emplace_back( region.getData(), pair.second, m_records );
+        }
+    }
+
+
+    /*
+      Region arrays where the span of region values is below this
+      limit get a dense (region1, region2) matrix; i.e. at most 1M
+      entries. Wider ranges of region values fall back to a hash map.
+    */
+    static const int MAX_DENSE_REGIONS = 1024;
+
+    MULTREGTScanner::RegionLookup::RegionLookup(const std::vector<int>& regions,
+                                                const MULTREGTSearchMap& searchMap,
+                                                const std::vector< MULTREGTRecord >& records) :
+        m_regions( regions )
+    {
+        int minRegion = 0;
+        int maxRegion = 0;
+        if (!searchMap.empty()) {
+            minRegion = std::min( searchMap.begin()->first.first, searchMap.begin()->first.second );
+            maxRegion = std::max( searchMap.begin()->first.first, searchMap.begin()->first.second );
+        }
+
+        for (const auto& pair : searchMap) {
+            minRegion = std::min( { minRegion, pair.first.first, pair.first.second } );
+            maxRegion = std::max( { maxRegion, pair.first.first, pair.first.second } );
+        }
+
+        m_minRegion = minRegion;
+        m_numRegions = maxRegion - minRegion + 1;
+
+        if (m_numRegions <= MAX_DENSE_REGIONS)
+            m_dense.assign( m_numRegions * m_numRegions, -1 );
+
+        for (const auto& pair : searchMap) {
+            int recordIndex = pair.second - records.data();
+            if (m_dense.empty())
+                m_sparse[ key( pair.first.first, pair.first.second ) ] = recordIndex;
+            else
+                m_dense[ (pair.first.first - m_minRegion) * m_numRegions + (pair.first.second - m_minRegion) ] = recordIndex;
         }
     }
 
 
+    int MULTREGTScanner::RegionLookup::region(size_t globalIndex) const {
+        return m_regions[globalIndex];
+    }
+
+
+    std::uint64_t MULTREGTScanner::RegionLookup::key(int regionId1, int regionId2) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(regionId1)) << 32) | static_cast<std::uint32_t>(regionId2);
+    }
+
+
+    /*
+      Returns the index of the MULTREGT record for the (regionId1 ->
+      regionId2) pair, or -1 if there is no such record.
+    */
+    int MULTREGTScanner::RegionLookup::find(int regionId1, int regionId2) const {
+        if (m_dense.empty()) {
+            auto iter = m_sparse.find( key( regionId1, regionId2 ));
+            if (iter == m_sparse.end())
+                return -1;
+
+            return iter->second;
+        }
+
+        const unsigned int index1 = regionId1 - m_minRegion;
+        const unsigned int index2 = regionId2 - m_minRegion;
+        const unsigned int numRegions = m_numRegions;
+        if (index1 >= numRegions || index2 >= numRegions)
+            return -1;
+
+        return m_dense[ index1 * numRegions + index2 ];
+    }
+
+
     void MULTREGTScanner::assertKeywordSupported( const DeckKeyword& deckKeyword, const std::string& defaultRegion) {
         for (auto iter = deckKeyword.begin(); iter != deckKeyword.end(); ++iter) {
             MULTREGTRecord record( *iter , defaultRegion);
@@ -233,26 +313,23 @@ namespace Opm {
     */
     double MULTREGTScanner::getRegionMultiplier(size_t globalIndex1 , size_t globalIndex2, FaceDir::DirEnum faceDir) const {
 
-        for (auto iter = m_searchMap.begin(); iter != m_searchMap.end(); iter++) {
-            const Opm::GridProperty<int>& region = m_e3DProps.getIntGridProperty( (*iter).first );
-            const MULTREGTSearchMap& map = (*iter).second;
-
-            int regionId1 = region.iget(globalIndex1);
-            int regionId2 = region.iget(globalIndex2);
+        for (const auto& lookup : m_lookup) {
+            int regionId1 = lookup.region(globalIndex1);
+            int regionId2 = lookup.region(globalIndex2);
 
-            std::pair<int,int> pair{ regionId1, regionId2 };
-            if (map.count(pair) != 1 || !(map.at(pair)->m_directions & faceDir)) {
-                pair = std::pair<int,int>{regionId2 , regionId1};
-                if (map.count(pair) != 1 || !(map.at(pair)->m_directions & faceDir))
+            int recordIndex = lookup.find( regionId1, regionId2 );
+            if (recordIndex < 0 || !(m_records[recordIndex].m_directions & faceDir)) {
+                recordIndex = lookup.find( regionId2, regionId1 );
+                if (recordIndex < 0 || !(m_records[recordIndex].m_directions & faceDir))
                     continue;
             }
-            const MULTREGTRecord* record = map.at(pair);
+            const MULTREGTRecord* record = &m_records[recordIndex];
 
             bool applyMultiplier = true;
-            int i1 = globalIndex1 % region.getNX();
-            int i2 = globalIndex2 % region.getNX();
-            int j1 = globalIndex1 / region.getNX() % region.getNY();
-            int j2 = globalIndex2 / region.getNX() % region.getNY();
+            int i1 = globalIndex1 % m_nx;
+            int i2 = globalIndex2 % m_nx;
+            int j1 = globalIndex1 / m_nx % m_ny;
+            int j2 = globalIndex2 / m_nx % m_ny;
 
             if (record->m_nncBehaviour == MULTREGT::NNC){
                 applyMultiplier = true;
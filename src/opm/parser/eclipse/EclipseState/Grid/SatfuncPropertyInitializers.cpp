@@ -506,7 +506,7 @@ namespace Opm {
         const auto& famII = [&sof3Tables,&crit_water,&min_gas]( int i ) {
             const double OilSatAtcritialWaterSat = 1.0 - crit_water[ i ] - min_gas[ i ];
             return sof3Tables.getTable< Sof3Table >( i )
-                .evaluate("KROW", OilSatAtcritialWaterSat);
+                .evaluate(Sof3Table::Column::KROW, OilSatAtcritialWaterSat);
         };
 
         switch( getSaturationFunctionFamily( tm ) ) {
@@ -540,7 +540,7 @@ namespace Opm {
         const auto& famII = [&sof3Tables,&crit_gas,&min_water]( int i ) {
             const double OilSatAtcritialGasSat = 1.0 - crit_gas[ i ] - min_water[ i ];
             return sof3Tables.getTable< Sof3Table >( i )
-                .evaluate("KROG", OilSatAtcritialGasSat);
+                .evaluate(Sof3Table::Column::KROG, OilSatAtcritialGasSat);
         };
 
         switch( getSaturationFunctionFamily( tm ) ) {
@@ -18,6 +18,8 @@
 */
 
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/parser/eclipse/EclipseState/Eclipse3DProperties.hpp>
@@ -84,6 +86,56 @@ namespace Opm {
         return m_multregtScanner.getRegionMultiplier(globalCellIndex1, globalCellIndex2, faceDir);
     }
 
+    std::vector<double> TransMult::getFaceMultipliers(FaceDir::DirEnum faceDir) const {
+        FaceDir::DirEnum oppositeDir;
+        size_t stride;
+        switch (faceDir) {
+        case FaceDir::XPlus:
+            oppositeDir = FaceDir::XMinus;
+            stride = 1;
+            break;
+        case FaceDir::YPlus:
+            oppositeDir = FaceDir::YMinus;
+            stride = m_nx;
+            break;
+        case FaceDir::ZPlus:
+            oppositeDir = FaceDir::ZMinus;
+            stride = m_nx * m_ny;
+            break;
+        default:
+            throw std::invalid_argument("Face multipliers can only be requested for the XPlus, YPlus and ZPlus directions");
+        }
+
+        const std::vector<double>* plusData = hasDirectionProperty( faceDir ) ? &m_trans.at( faceDir ).getData() : nullptr;
+        const std::vector<double>* minusData = hasDirectionProperty( oppositeDir ) ? &m_trans.at( oppositeDir ).getData() : nullptr;
+
+        // The last layer of cells in the faceDir direction has no neighbour.
+        const long iEnd = m_nx - (faceDir == FaceDir::XPlus ? 1 : 0);
+        const long jEnd = m_ny - (faceDir == FaceDir::YPlus ? 1 : 0);
+        const long kEnd = m_nz - (faceDir == FaceDir::ZPlus ? 1 : 0);
+        std::vector<double> faceMult( m_nx * m_ny * m_nz , 1.0 );
+
+#pragma omp parallel for schedule(static)
+        for (long k = 0; k < kEnd; k++) {
+            for (long j = 0; j < jEnd; j++) {
+                for (long i = 0; i < iEnd; i++) {
+                    const size_t globalIndex1 = i + j*m_nx + k*m_nx*m_ny;
+                    const size_t globalIndex2 = globalIndex1 + stride;
+                    double mult = m_multregtScanner.getRegionMultiplier( globalIndex1, globalIndex2, faceDir );
+                    if (plusData)
+                        mult *= (*plusData)[globalIndex1];
+
+                    if (minusData)
+                        mult *= (*minusData)[globalIndex2];
+
+                    faceMult[globalIndex1] = mult;
+                }
+            }
+        }
+
+        return faceMult;
+    }
+
     bool TransMult::hasDirectionProperty(FaceDir::DirEnum faceDir) const {
         return m_trans.count(faceDir) == 1;
     }
@@ -119,18 +171,36 @@ namespace Opm {
             FaceDir::DirEnum faceDir = face.getDir();
             auto& multProperty = getDirectionProperty(faceDir);
 
-
-            for( auto globalIndex : face ) {
-                multProperty.multiplyValueAtIndex( globalIndex , transMult);
-            }
+            face.multiply( multProperty.getData().data(), transMult, 0, m_nz );
         }
     }
 
 
+    /*
+      The fault faces are grouped by direction, and each direction has
+      its own multiplier property. Within one direction the layers are
+      distributed among the threads, so two threads never write to the
+      same cell, and the multipliers for each cell are applied in the
+      same order as when traversing the faults one by one.
+    */
     void TransMult::applyMULTFLT(const FaultCollection& faults) {
+        std::map<FaceDir::DirEnum, std::vector<std::pair<const FaultFace*, double>>> dirFaces;
         for (size_t faultIndex = 0; faultIndex < faults.size(); faultIndex++) {
-            auto& fault = faults.getFault(faultIndex);
-            applyMULTFLT(fault);
+            const auto& fault = faults.getFault(faultIndex);
+            for (const auto& face : fault)
+                dirFaces[face.getDir()].emplace_back( &face, fault.getTransMult() );
+        }
+
+        for (const auto& pair : dirFaces) {
+            double* data = getDirectionProperty(pair.first).getData().data();
+            const auto& faces = pair.second;
+            const long nz = m_nz;
+
+#pragma omp parallel for schedule(dynamic)
+            for (long k = 0; k < nz; k++) {
+                for (const auto& face : faces)
+                    face.first->multiply( data, face.second, k, k + 1 );
+            }
         }
     }
-    }
+}
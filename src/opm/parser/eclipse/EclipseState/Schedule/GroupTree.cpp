@@ -17,23 +17,26 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <algorithm>
 #include <stdexcept>
 
 #include <opm/parser/eclipse/EclipseState/Schedule/GroupTree.hpp>
 
 namespace Opm {
 
+GroupTree::GroupTree() {
+    this->insert( "FIELD", -1 );
+}
+
 void GroupTree::update( const std::string& name ) {
     this->update( name, "FIELD" );
 }
 
 /*
- * Insertions are only done via the update method which maintains the
- * underlying group vector sorted on group names. This requires group names to
- * be unique, but simplifies the implementation greatly and emphasises that
- * this grouptree class is just meta data for the actual group objects (stored
- * and represented elsewhere)
+ * Insertions are only done via the update method, which adds a missing
+ * parent group beneath FIELD. This requires group names to be unique, but
+ * simplifies the implementation greatly and emphasises that this grouptree
+ * class is just meta data for the actual group objects (stored and
+ * represented elsewhere)
  */
 
 void GroupTree::update( const std::string& name, const std::string& other_parent ) {
@@ -43,34 +46,36 @@ void GroupTree::update( const std::string& name, const std::string& other_parent
     if( other_parent.empty() )
         throw std::invalid_argument( "Parent group must have a name." );
 
-    auto root = this->find( other_parent );
-
-    if( root == this->groups.end() || root->name != other_parent )
-        this->groups.insert( root, 1, group { other_parent, "FIELD" } );
-
-    auto node = this->find( name );
+    auto root = this->ids.find( other_parent );
+    const int parent_id = root == this->ids.end()
+                        ? this->insert( other_parent, 0 )
+                        : root->second;
 
-    if( node == this->groups.end() || node->name != name ) {
-        this->groups.insert( node, 1, group { name, other_parent } );
+    auto node = this->ids.find( name );
+    if( node == this->ids.end() ) {
+        this->insert( name, parent_id );
         return;
     }
 
-    node->parent = other_parent;
+    if( this->parents[ node->second ] == parent_id ) return;
+
+    this->unlink( node->second );
+    this->link( node->second, parent_id );
 }
 
 bool GroupTree::exists( const std::string& name ) const {
-    return std::binary_search( this->groups.begin(),
-                               this->groups.end(),
-                               name );
+    return this->ids.count( name ) > 0;
 }
 
 const std::string& GroupTree::parent( const std::string& name ) const {
-    auto node = std::find( this->groups.begin(), this->groups.end(), name );
+    static const std::string no_parent;
 
-    if( node == this->groups.end() )
+    auto node = this->ids.find( name );
+    if( node == this->ids.end() )
         throw std::out_of_range( "No such parent '" + name + "'." );
 
-    return node->parent;
+    const int parent_id = this->parents[ node->second ];
+    return parent_id < 0 ? no_parent : this->names[ parent_id ];
 }
 
 std::vector< std::string > GroupTree::children( const std::string& other_parent ) const {
@@ -78,57 +83,104 @@ std::vector< std::string > GroupTree::children( const std::string& other_parent
         throw std::out_of_range( "Node '" + other_parent + "' does not exist." );
 
     std::vector< std::string > kids;
-    for( const auto& node : this->groups ) {
-        if( node.parent != other_parent ) continue;
-        kids.push_back( node.name );
-    }
+    const int parent_id = this->ids.at( other_parent );
+    for( int child = this->first_child[ parent_id ]; child >= 0; child = this->next_sibling[ child ] )
+        kids.push_back( this->names[ child ] );
 
     return kids;
 }
 
-bool GroupTree::operator==( const GroupTree& rhs ) const {
-    return this->groups.size() == rhs.groups.size()
-        && std::equal( this->groups.begin(),
-                       this->groups.end(),
-                       rhs.groups.begin() );
+size_t GroupTree::size() const {
+    return this->names.size();
 }
 
-bool GroupTree::operator!=( const GroupTree& rhs ) const {
-    return !( *this == rhs );
+int GroupTree::groupId( const std::string& name ) const {
+    auto node = this->ids.find( name );
+    if( node == this->ids.end() )
+        throw std::out_of_range( "No such group '" + name + "'." );
+
+    return node->second;
 }
 
-bool GroupTree::group::operator==( const std::string& rhs ) const {
-    return this->name == rhs;
+const std::string& GroupTree::groupName( int id ) const {
+    return this->names.at( id );
 }
 
-bool GroupTree::group::operator!=( const std::string& rhs ) const {
-    return !( *this == rhs );
+int GroupTree::parentId( int id ) const {
+    return this->parents.at( id );
 }
 
-bool GroupTree::group::operator==( const GroupTree::group& rhs ) const {
-    return this->name == rhs.name && this->parent == rhs.parent;
+int GroupTree::firstChild( int id ) const {
+    return this->first_child.at( id );
 }
 
-bool GroupTree::group::operator!=( const GroupTree::group& rhs ) const {
-    return !( *this == rhs );
+int GroupTree::nextSibling( int id ) const {
+    return this->next_sibling.at( id );
 }
 
-bool GroupTree::group::operator<( const GroupTree::group& rhs ) const {
-    return this->name < rhs.name;
+/*
+ * Two trees are equal if they contain the same groups with the same
+ * parents; the ids the groups happened to get are not compared.
+ */
+bool GroupTree::operator==( const GroupTree& rhs ) const {
+    if( this->names.size() != rhs.names.size() ) return false;
+
+    for( size_t id = 0; id < this->names.size(); ++id ) {
+        auto other = rhs.ids.find( this->names[ id ] );
+        if( other == rhs.ids.end() ) return false;
+
+        const int parent_id = this->parents[ id ];
+        const int other_parent_id = rhs.parents[ other->second ];
+        if( ( parent_id < 0 ) != ( other_parent_id < 0 ) ) return false;
+        if( parent_id >= 0 && this->names[ parent_id ] != rhs.names[ other_parent_id ] )
+            return false;
+    }
+
+    return true;
 }
 
-bool GroupTree::group::operator<( const std::string& rhs ) const {
-    return this->name < rhs;
+bool GroupTree::operator!=( const GroupTree& rhs ) const {
+    return !( *this == rhs );
 }
 
-bool operator<( const std::string& lhs, const GroupTree::group& rhs ) {
-    return lhs < rhs.name;
+int GroupTree::insert( const std::string& name, int parent_id ) {
+    const int id = this->names.size();
+
+    this->names.push_back( name );
+    this->ids.emplace( name, id );
+    this->parents.push_back( -1 );
+    this->first_child.push_back( -1 );
+    this->next_sibling.push_back( -1 );
+
+    if( parent_id >= 0 )
+        this->link( id, parent_id );
+
+    return id;
 }
 
-std::vector< GroupTree::group >::iterator GroupTree::find( const std::string& name ) {
-    return std::lower_bound( this->groups.begin(),
-                             this->groups.end(),
-                             name );
+/*
+ * Insert the group in the child list of its new parent, keeping the
+ * children sorted on name.
+ */
+void GroupTree::link( int id, int parent_id ) {
+    this->parents[ id ] = parent_id;
+
+    int* pos = &this->first_child[ parent_id ];
+    while( *pos >= 0 && this->names[ *pos ] < this->names[ id ] )
+        pos = &this->next_sibling[ *pos ];
+
+    this->next_sibling[ id ] = *pos;
+    *pos = id;
+}
+
+void GroupTree::unlink( int id ) {
+    int* pos = &this->first_child[ this->parents[ id ] ];
+    while( *pos != id )
+        pos = &this->next_sibling[ *pos ];
+
+    *pos = this->next_sibling[ id ];
+    this->next_sibling[ id ] = -1;
+    this->parents[ id ] = -1;
 }
 
 }
@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <exception>
 #include <string>
 #include <vector>
 #include <stdexcept>
@@ -59,6 +60,24 @@
 
 namespace Opm {
 
+namespace {
+
+    /*
+      Well and group name patterns are only treated as patterns when
+      the first '*' is the last character; this returns true if in
+      addition the part before the '*' is a plain name prefix which can
+      be looked up in a NameIndex. Patterns with '?', '[' or '\\' in
+      the prefix must still be resolved with fnmatch().
+    */
+    bool is_prefix_pattern(const std::string& pattern) {
+        if (pattern.empty() || pattern.find('*') != pattern.size() - 1)
+            return false;
+
+        return pattern.find_first_of("?[\\") == std::string::npos;
+    }
+
+}
+
     Schedule::Schedule( const Deck& deck,
                         const EclipseGrid& grid,
                         const Eclipse3DProperties& eclipseProperties,
@@ -72,7 +91,9 @@ namespace Opm {
         m_tuning( this->m_timeMap ),
         m_messageLimits( this->m_timeMap ),
         m_phases(phases),
-        wtest_config(this->m_timeMap, std::make_shared<WellTestConfig>() )
+        wtest_config(this->m_timeMap, std::make_shared<WellTestConfig>() ),
+        m_defined_wells( this->m_timeMap, {} ),
+        m_open_wells( this->m_timeMap, {} )
     {
         m_controlModeWHISTCTL = WellProducer::CMODE_UNDEFINED;
         addGroup( "FIELD", 0 );
@@ -93,6 +114,42 @@ namespace Opm {
 
         if (Section::hasSCHEDULE(deck))
             iterateScheduleSection( parseContext, SCHEDULESection( deck ), grid, eclipseProperties );
+
+        updateWellViews();
+    }
+
+
+    /*
+      The well views hold pointers to the wells in m_wells; a copy must
+      rebuild them to point to its own wells.
+    */
+    Schedule::Schedule(const Schedule& other) :
+        m_timeMap( other.m_timeMap ),
+        m_wells( other.m_wells ),
+        m_groups( other.m_groups ),
+        m_well_names( other.m_well_names ),
+        m_group_names( other.m_group_names ),
+        m_rootGroupTree( other.m_rootGroupTree ),
+        m_oilvaporizationproperties( other.m_oilvaporizationproperties ),
+        m_events( other.m_events ),
+        m_modifierDeck( other.m_modifierDeck ),
+        m_tuning( other.m_tuning ),
+        m_messageLimits( other.m_messageLimits ),
+        m_phases( other.m_phases ),
+        vfpprod_tables( other.vfpprod_tables ),
+        vfpinj_tables( other.vfpinj_tables ),
+        wtest_config( other.wtest_config ),
+        m_defined_wells( this->m_timeMap, {} ),
+        m_open_wells( this->m_timeMap, {} ),
+        m_controlModeWHISTCTL( other.m_controlModeWHISTCTL )
+    {
+        updateWellViews();
+    }
+
+
+    Schedule& Schedule::operator=(const Schedule& other) {
+        Schedule copy( other );
+        return *this = std::move( copy );
     }
 
 
@@ -147,6 +204,41 @@ namespace Opm {
         std::vector<std::pair< const DeckKeyword* , size_t> > rftProperties;
         const auto& unit_system = section.unitSystem();
 
+        /*
+          The VFPPROD and VFPINJ tables only depend on their own keyword,
+          and building them is the most expensive part of the schedule
+          section. They are therefore built up front in parallel, and
+          then added to the schedule in deck order by the main loop
+          below. An error from a table is rethrown when the main loop
+          reaches its keyword, so errors are still reported in deck
+          order.
+        */
+        std::vector<const DeckKeyword*> vfp_keywords;
+        for (size_t keywordIdx = 0; keywordIdx < section.size(); ++keywordIdx) {
+            const auto& keyword = section.getKeyword(keywordIdx);
+            if (keyword.name() == "VFPPROD" || keyword.name() == "VFPINJ")
+                vfp_keywords.push_back( &keyword );
+        }
+
+        const long num_vfp = vfp_keywords.size();
+        std::vector<std::shared_ptr<VFPProdTable>> vfpprod( num_vfp );
+        std::vector<std::shared_ptr<VFPInjTable>> vfpinj( num_vfp );
+        std::vector<std::exception_ptr> vfp_errors( num_vfp );
+
+#pragma omp parallel for schedule(dynamic)
+        for (long vfp_index = 0; vfp_index < num_vfp; ++vfp_index) {
+            const auto& keyword = *vfp_keywords[vfp_index];
+            try {
+                if (keyword.name() == "VFPPROD")
+                    vfpprod[vfp_index] = std::make_shared<VFPProdTable>(keyword, unit_system);
+                else
+                    vfpinj[vfp_index] = std::make_shared<VFPInjTable>(keyword, unit_system);
+            } catch (...) {
+                vfp_errors[vfp_index] = std::current_exception();
+            }
+        }
+        size_t vfp_index = 0;
+
         for (size_t keywordIdx = 0; keywordIdx < section.size(); ++keywordIdx) {
             const auto& keyword = section.getKeyword(keywordIdx);
 
@@ -262,11 +354,17 @@ namespace Opm {
             else if (keyword.name() == "WEFAC")
                 handleWEFAC(keyword, currentStep, parseContext);
 
-            else if (keyword.name() == "VFPINJ")
-                handleVFPINJ(keyword, unit_system, currentStep);
+            else if (keyword.name() == "VFPINJ" || keyword.name() == "VFPPROD") {
+                if (vfp_errors[vfp_index])
+                    std::rethrow_exception( vfp_errors[vfp_index] );
 
-            else if (keyword.name() == "VFPPROD")
-                handleVFPPROD(keyword, unit_system, currentStep);
+                if (keyword.name() == "VFPINJ")
+                    handleVFPINJ(vfpinj[vfp_index], currentStep);
+                else
+                    handleVFPPROD(vfpprod[vfp_index], currentStep);
+
+                ++vfp_index;
+            }
 
             else if (geoModifiers.find( keyword.name() ) != geoModifiers.end()) {
                 bool supported = geoModifiers.at( keyword.name() );
@@ -345,8 +443,7 @@ namespace Opm {
         }
     }
 
-    void Schedule::handleVFPINJ(const DeckKeyword& vfpinjKeyword, const UnitSystem& unit_system, size_t currentStep) {
-        std::shared_ptr<VFPInjTable> table = std::make_shared<VFPInjTable>(vfpinjKeyword, unit_system);
+    void Schedule::handleVFPINJ(std::shared_ptr<VFPInjTable> table, size_t currentStep) {
         int table_id = table->getTableNum();
 
         const auto iter = vfpinj_tables.find(table_id);
@@ -359,8 +456,7 @@ namespace Opm {
         this->m_events.addEvent( ScheduleEvents::VFPINJ_UPDATE , currentStep);
     }
 
-    void Schedule::handleVFPPROD(const DeckKeyword& vfpprodKeyword, const UnitSystem& unit_system, size_t currentStep) {
-        std::shared_ptr<VFPProdTable> table = std::make_shared<VFPProdTable>(vfpprodKeyword, unit_system);
+    void Schedule::handleVFPPROD(std::shared_ptr<VFPProdTable> table, size_t currentStep) {
         int table_id = table->getTableNum();
 
         const auto iter = vfpprod_tables.find(table_id);
@@ -1447,6 +1543,7 @@ namespace Opm {
                   wellConnectionOrder, allowCrossFlow, automaticShutIn);
 
         m_wells.insert( wellName, well );
+        m_well_names.insert( wellName, m_wells.size() - 1 );
         m_events.addEvent( ScheduleEvents::NEW_WELL , timeStep );
     }
 
@@ -1462,56 +1559,24 @@ namespace Opm {
         return m_wells.hasKey( wellName );
     }
 
-    std::vector< const Well* > Schedule::getWells() const {
+    const std::vector< const Well* >& Schedule::getWells() const {
         return getWells(m_timeMap.size()-1);
     }
 
-    /*
-      This will recursively go all the way down through the group tree
-      until the well leaf-nodes are encountered.
-    */
-    std::vector< const Well* > Schedule::getWells(const std::string& group_name, size_t timeStep) const {
-        if (!hasGroup(group_name))
+    const std::vector< const Well* >& Schedule::getWells(const std::string& group_name, size_t timeStep) const {
+        const auto iter = m_group_wells.find( group_name );
+        if (iter == m_group_wells.end())
             throw std::invalid_argument("No such group: " + group_name);
-        {
-            const auto& group = getGroup( group_name );
-            std::vector<const Well*> wells;
-
-            if (group.hasBeenDefined( timeStep )) {
-                const GroupTree& group_tree = getGroupTree( timeStep );
-                const auto& child_groups = group_tree.children( group_name );
-
-                if (child_groups.size()) {
-                    for (const auto& child : child_groups) {
-                        const auto& child_wells = getWells( child, timeStep );
-                        wells.insert( wells.end() , child_wells.begin() , child_wells.end());
-                    }
-                } else {
-                    for (const auto& well_name : group.getWells( timeStep )) {
-                        wells.push_back( getWell( well_name ));
-                    }
-                }
-            }
-            return wells;
-        }
+
+        return iter->second.at( timeStep );
     }
 
-    std::vector< const Well* > Schedule::getWells(size_t timeStep) const {
+    const std::vector< const Well* >& Schedule::getWells(size_t timeStep) const {
         if (timeStep >= m_timeMap.size()) {
             throw std::invalid_argument("Timestep to large");
         }
 
-        auto defined = [=]( const Well& w ) {
-            return w.hasBeenDefined( timeStep );
-        };
-
-        std::vector< const Well* > wells;
-        for( const auto& well : m_wells ) {
-            if( !defined( well ) ) continue;
-            wells.push_back( std::addressof( well ) );
-        }
-
-        return wells;
+        return m_defined_wells.get( timeStep );
     }
 
     const Well* Schedule::getWell(const std::string& wellName) const {
@@ -1525,26 +1590,24 @@ namespace Opm {
       been opened by the simulator.
     */
 
-    std::vector< const Well* > Schedule::getOpenWells(size_t timeStep) const {
+    const std::vector< const Well* >& Schedule::getOpenWells(size_t timeStep) const {
+        return m_open_wells.at( timeStep );
+    }
 
-        auto open = [=]( const Well& w ) {
-            return w.getStatus( timeStep ) == WellCommon::OPEN;
-        };
+    std::vector< const Well* > Schedule::getWellsMatching( const std::string& wellNamePattern ) const {
+        if( !is_prefix_pattern( wellNamePattern ) ) {
+            auto tmp = const_cast< Schedule* >( this )->getWells( wellNamePattern );
+            return { tmp.begin(), tmp.end() };
+        }
 
+        const auto prefix = wellNamePattern.substr( 0, wellNamePattern.size() - 1 );
         std::vector< const Well* > wells;
-        for( const auto& well : m_wells ) {
-            if( !open( well ) ) continue;
-            wells.push_back( std::addressof( well ) );
-        }
+        for( auto index : m_well_names.prefixMatch( prefix ) )
+            wells.push_back( std::addressof( m_wells.get( index ) ) );
 
         return wells;
     }
 
-    std::vector< const Well* > Schedule::getWellsMatching( const std::string& wellNamePattern ) const {
-        auto tmp = const_cast< Schedule* >( this )->getWells( wellNamePattern );
-        return { tmp.begin(), tmp.end() };
-    }
-
     std::vector< Well* > Schedule::getWells(const std::string& wellNamePattern) {
         size_t wildcard_pos = wellNamePattern.find("*");
 
@@ -1554,6 +1617,14 @@ namespace Opm {
         }
 
         std::vector< Well* > wells;
+        if( is_prefix_pattern( wellNamePattern ) ) {
+            const auto prefix = wellNamePattern.substr( 0, wellNamePattern.size() - 1 );
+            for( auto index : m_well_names.cachedPrefixMatch( prefix ) )
+                wells.push_back( std::addressof( m_wells.get( index ) ) );
+
+            return wells;
+        }
+
         for( auto& well : this->m_wells ) {
             if( Well::wellNameInWellNamePattern( well.name(), wellNamePattern ) ) {
                 wells.push_back( std::addressof( well ) );
@@ -1565,6 +1636,7 @@ namespace Opm {
 
     void Schedule::addGroup(const std::string& groupName, size_t timeStep) {
         m_groups.insert( groupName, Group { groupName, m_timeMap, timeStep } );
+        m_group_names.insert( groupName, m_groups.size() - 1 );
         m_events.addEvent( ScheduleEvents::NEW_GROUP , timeStep );
     }
 
@@ -1602,6 +1674,14 @@ namespace Opm {
         }
 
         std::vector< Group* > groups;
+        if( is_prefix_pattern( groupNamePattern ) ) {
+            const auto prefix = groupNamePattern.substr( 0, groupNamePattern.size() - 1 );
+            for( auto index : m_group_names.cachedPrefixMatch( prefix ) )
+                groups.push_back( std::addressof( m_groups.get( index ) ) );
+
+            return groups;
+        }
+
         for( auto& group : this->m_groups ) {
             if( Group::groupNameInGroupNamePattern( group.name(), groupNamePattern ) ) {
                 groups.push_back( std::addressof( group ) );
@@ -1720,6 +1800,74 @@ namespace Opm {
     }
 
 
+    /*
+      This will recursively go all the way down through the group tree
+      until the well leaf-nodes are encountered.
+    */
+    std::vector< const Well* > Schedule::groupWells(const std::string& group_name, size_t timeStep) const {
+        const auto& group = getGroup( group_name );
+        std::vector<const Well*> wells;
+
+        if (group.hasBeenDefined( timeStep )) {
+            /*
+              Groups created by e.g. GRUPNET need not be part of the
+              group tree; they are treated as leaf groups.
+            */
+            const GroupTree& group_tree = getGroupTree( timeStep );
+            const auto child_groups = group_tree.exists( group_name )
+                ? group_tree.children( group_name )
+                : std::vector< std::string >{};
+
+            if (child_groups.size()) {
+                for (const auto& child : child_groups) {
+                    const auto& child_wells = groupWells( child, timeStep );
+                    wells.insert( wells.end() , child_wells.begin() , child_wells.end());
+                }
+            } else {
+                for (const auto& well_name : group.getWells( timeStep )) {
+                    wells.push_back( getWell( well_name ));
+                }
+            }
+        }
+        return wells;
+    }
+
+
+    /*
+      The lists of defined wells, open wells and the wells beneath each
+      group are assembled once, when the schedule is complete, and
+      stored as change points so that the per report step queries do
+      not have to scan all the wells.
+    */
+    void Schedule::updateWellViews() {
+        m_defined_wells.globalReset( {} );
+        m_open_wells.globalReset( {} );
+        m_group_wells.clear();
+
+        for (const auto& group : m_groups)
+            m_group_wells.emplace( group.name(), DynamicState< std::vector< const Well* > >( m_timeMap, {} ) );
+
+        std::vector< const Well* > defined;
+        std::vector< const Well* > open;
+        for (size_t timeStep = 0; timeStep < m_timeMap.size(); ++timeStep) {
+            defined.clear();
+            open.clear();
+            for (const auto& well : m_wells) {
+                if (well.hasBeenDefined( timeStep ))
+                    defined.push_back( std::addressof( well ) );
+
+                if (well.getStatus( timeStep ) == WellCommon::OPEN)
+                    open.push_back( std::addressof( well ) );
+            }
+
+            m_defined_wells.update( timeStep, defined );
+            m_open_wells.update( timeStep, open );
+
+            for (auto& pair : m_group_wells)
+                pair.second.update( timeStep, groupWells( pair.first, timeStep ) );
+        }
+    }
+
     void Schedule::filterConnections(const EclipseGrid& grid) {
         for (auto& well : this->m_wells)
             well.filterConnections(grid);
@@ -69,6 +69,7 @@ VFPInjTable::VFPInjTable(int table_num,
     m_data = data;
 
     check();
+    initAxes();
 }
 
 
@@ -188,6 +189,59 @@ VFPInjTable::VFPInjTable( const DeckKeyword& table, const UnitSystem& deck_unit_
     }
 
     check();
+    initAxes();
+}
+
+
+void VFPInjTable::initAxes() {
+    m_flo_axis = VFPAxis(m_flo_data);
+    m_thp_axis = VFPAxis(m_thp_data);
+}
+
+
+VFPEvaluation VFPInjTable::interpolate(const VFPAxisPoint& flo, const VFPAxisPoint& thp) const {
+    VFPEvaluation nodes[2];
+
+    for (int c = 0; c < 2; ++c) {
+        const size_t t = c ? thp.next : thp.index;
+        const double v1 = m_data[t][flo.index];
+        const double v2 = m_data[t][flo.next];
+
+        nodes[c].value = (1.0 - flo.factor) * v1 + flo.factor * v2;
+        nodes[c].dflo = (v2 - v1) * flo.inv_width;
+    }
+
+    return VFPInterpolate(nodes[0], nodes[1], thp, &VFPEvaluation::dthp);
+}
+
+
+VFPEvaluation VFPInjTable::bhp(double flo, double thp) const {
+    return interpolate(m_flo_axis.find(flo), m_thp_axis.find(thp));
+}
+
+
+std::vector<VFPEvaluation> VFPInjTable::bhp(const std::vector<double>& flo,
+                                            const std::vector<double>& thp) const {
+    const long size = flo.size();
+    if (thp.size() != flo.size())
+        throw std::invalid_argument("Size mismatch between VFPINJ argument vectors");
+
+    std::vector<VFPEvaluation> result(size);
+#pragma omp parallel for schedule(static)
+    for (long i = 0; i < size; ++i)
+        result[i] = bhp(flo[i], thp[i]);
+
+    return result;
+}
+
+
+double VFPInjTable::thp(double flo, double bhp_value) const {
+    const auto flo_point = m_flo_axis.find(flo);
+    const auto bhp_function = [&](double thp_value) {
+        return interpolate(flo_point, m_thp_axis.find(thp_value));
+    };
+
+    return VFPFindTHP(bhp_function, m_thp_data, bhp_value);
 }
 
 
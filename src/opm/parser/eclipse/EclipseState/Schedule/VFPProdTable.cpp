@@ -158,6 +158,7 @@ VFPProdTable::VFPProdTable(int table_num,
     m_data.resize(shape);
     m_data = data;
 
+    initAxes();
     //check();
 }
 
@@ -310,6 +311,96 @@ VFPProdTable::VFPProdTable( const DeckKeyword& table, const UnitSystem& deck_uni
     }
 
     check(table, table_scaling_factor);
+    initAxes();
+}
+
+
+void VFPProdTable::initAxes() {
+    m_flo_axis = VFPAxis(m_flo_data);
+    m_thp_axis = VFPAxis(m_thp_data);
+    m_wfr_axis = VFPAxis(m_wfr_data);
+    m_gfr_axis = VFPAxis(m_gfr_data);
+    m_alq_axis = VFPAxis(m_alq_data);
+}
+
+
+/*
+  The table is stored row-major with FLO as the fastest running index,
+  so each of the 16 THP/WFR/GFR/ALQ corners of the interpolation
+  stencil reads an adjacent pair of FLO values. The corners are then
+  reduced one axis at a time, starting with ALQ.
+*/
+VFPEvaluation VFPProdTable::interpolate(const VFPAxisPoint& flo,
+                                        const VFPAxisPoint& thp,
+                                        const VFPAxisPoint& wfr,
+                                        const VFPAxisPoint& gfr,
+                                        const VFPAxisPoint& alq) const {
+    const double* data = m_data.data();
+    const auto* strides = m_data.strides();
+    VFPEvaluation nodes[16];
+
+    for (int c = 0; c < 16; ++c) {
+        const size_t offset = ((c & 8) ? thp.next : thp.index) * strides[0]
+                            + ((c & 4) ? wfr.next : wfr.index) * strides[1]
+                            + ((c & 2) ? gfr.next : gfr.index) * strides[2]
+                            + ((c & 1) ? alq.next : alq.index) * strides[3];
+        const double v1 = data[offset + flo.index * strides[4]];
+        const double v2 = data[offset + flo.next * strides[4]];
+
+        nodes[c].value = (1.0 - flo.factor) * v1 + flo.factor * v2;
+        nodes[c].dflo = (v2 - v1) * flo.inv_width;
+    }
+
+    for (int c = 0; c < 8; ++c)
+        nodes[c] = VFPInterpolate(nodes[2*c], nodes[2*c + 1], alq, &VFPEvaluation::dalq);
+
+    for (int c = 0; c < 4; ++c)
+        nodes[c] = VFPInterpolate(nodes[2*c], nodes[2*c + 1], gfr, &VFPEvaluation::dgfr);
+
+    for (int c = 0; c < 2; ++c)
+        nodes[c] = VFPInterpolate(nodes[2*c], nodes[2*c + 1], wfr, &VFPEvaluation::dwfr);
+
+    return VFPInterpolate(nodes[0], nodes[1], thp, &VFPEvaluation::dthp);
+}
+
+
+VFPEvaluation VFPProdTable::bhp(double flo, double thp, double wfr, double gfr, double alq) const {
+    return interpolate(m_flo_axis.find(flo),
+                       m_thp_axis.find(thp),
+                       m_wfr_axis.find(wfr),
+                       m_gfr_axis.find(gfr),
+                       m_alq_axis.find(alq));
+}
+
+
+std::vector<VFPEvaluation> VFPProdTable::bhp(const std::vector<double>& flo,
+                                             const std::vector<double>& thp,
+                                             const std::vector<double>& wfr,
+                                             const std::vector<double>& gfr,
+                                             const std::vector<double>& alq) const {
+    const long size = flo.size();
+    if (thp.size() != flo.size() || wfr.size() != flo.size() || gfr.size() != flo.size() || alq.size() != flo.size())
+        throw std::invalid_argument("Size mismatch between VFPPROD argument vectors");
+
+    std::vector<VFPEvaluation> result(size);
+#pragma omp parallel for schedule(static)
+    for (long i = 0; i < size; ++i)
+        result[i] = bhp(flo[i], thp[i], wfr[i], gfr[i], alq[i]);
+
+    return result;
+}
+
+
+double VFPProdTable::thp(double flo, double wfr, double gfr, double alq, double bhp_value) const {
+    const auto flo_point = m_flo_axis.find(flo);
+    const auto wfr_point = m_wfr_axis.find(wfr);
+    const auto gfr_point = m_gfr_axis.find(gfr);
+    const auto alq_point = m_alq_axis.find(alq);
+    const auto bhp_function = [&](double thp_value) {
+        return interpolate(flo_point, m_thp_axis.find(thp_value), wfr_point, gfr_point, alq_point);
+    };
+
+    return VFPFindTHP(bhp_function, m_thp_data, bhp_value);
 }
 
 
@@ -399,16 +490,21 @@ void VFPProdTable::check(const DeckKeyword& keyword, const double table_scaling_
         }
     }
 
+    // Tables may be built concurrently by the Schedule; keep the two
+    // log messages of one table together.
     if (!points.empty()) {
-        OpmLog::warning("VFP table for production wells has BHP versus THP not " 
-                           + std::string("monotonically increasing.\nThis may cause convergence ")
-                           + "issues due to switching between BHP and THP control mode."
-                           + std::string("\nIn keyword VFPPROD table number ") 
-                           + std::to_string(m_table_num)
-                           + ", file " + keyword.getFileName()
-                           + ", line " + std::to_string(keyword.getLineNumber())
-                           + "\n");
-        OpmLog::note(points);
+#pragma omp critical(VFPProdTable_check)
+        {
+            OpmLog::warning("VFP table for production wells has BHP versus THP not "
+                               + std::string("monotonically increasing.\nThis may cause convergence ")
+                               + "issues due to switching between BHP and THP control mode."
+                               + std::string("\nIn keyword VFPPROD table number ")
+                               + std::to_string(m_table_num)
+                               + ", file " + keyword.getFileName()
+                               + ", line " + std::to_string(keyword.getLineNumber())
+                               + "\n");
+            OpmLog::note(points);
+        }
     }
 }
 
@@ -577,7 +577,8 @@ namespace Opm {
     void Well::filterConnections(const EclipseGrid& grid) {
         /*
           The m_completions member variable is DynamicState<WellConnections>
-          instance, hence this for loop is over all timesteps.
+          instance, hence this for loop is over all the distinct connection
+          sets.
         */
         for (auto& completions : m_completions)
             completions->filter(grid);
@@ -17,9 +17,14 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <limits>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include <opm/parser/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/parser/eclipse/EclipseState/Eclipse3DProperties.hpp>
@@ -29,6 +34,133 @@
 
 namespace Opm {
 
+namespace {
+
+    /*
+      The ColumnIndex is used when ordering the connections along the
+      well track. It buckets the connections which have not yet been
+      ordered on their (i,j) column, and finds the closest connection by
+      searching the columns in square rings of increasing size around the
+      current position. The search stops when no column in the next ring
+      can be closer than the best connection found so far; if the rings
+      would need more column lookups than there are remaining
+      connections, all the remaining connections are checked instead.
+
+      The connection chosen is the one with the smallest (i,j) distance,
+      then the smallest depth difference and finally the lowest position
+      in the connection vector - i.e. exactly the connection a linear
+      scan from 'start_pos' would choose - and it is swapped into
+      'start_pos' just like the linear scan used to do.
+    */
+
+    class ColumnIndex {
+    public:
+        explicit ColumnIndex(const std::vector< Connection >& connections);
+        void moveClosest(int oi, int oj, double oz, size_t start_pos, std::vector< Connection >& connections);
+
+    private:
+        using column_map = std::map< std::pair< int, int >, std::vector< size_t > >;
+
+        struct Candidate {
+            int ijdist2 = std::numeric_limits<int>::max();
+            double zdiff = std::numeric_limits<double>::max();
+            size_t pos = std::numeric_limits<size_t>::max();
+            column_map::iterator column;
+        };
+
+        column_map columns;
+        std::vector< size_t > id_at;
+        std::vector< size_t > pos_of;
+        std::vector< double > depth;
+        size_t remaining;
+    };
+
+
+    ColumnIndex::ColumnIndex(const std::vector< Connection >& connections) :
+        id_at( connections.size() ),
+        pos_of( connections.size() ),
+        depth( connections.size() )
+    {
+        for (size_t pos = 0; pos < connections.size(); ++pos) {
+            const auto& connection = connections[pos];
+            this->id_at[pos] = pos;
+            this->pos_of[pos] = pos;
+            this->depth[pos] = connection.center_depth;
+            this->columns[ std::make_pair(connection.getI(), connection.getJ()) ].push_back( pos );
+        }
+        this->remaining = connections.size();
+    }
+
+
+    void ColumnIndex::moveClosest(int oi, int oj, double oz, size_t start_pos, std::vector< Connection >& connections) {
+        Candidate best;
+
+        const auto consider = [&](column_map::iterator column, int ijdist2) {
+            for (const auto id : column->second) {
+                const double zdiff = std::abs(this->depth[id] - oz);
+                const size_t pos = this->pos_of[id];
+                if (std::tie(ijdist2, zdiff, pos) < std::tie(best.ijdist2, best.zdiff, best.pos)) {
+                    best.ijdist2 = ijdist2;
+                    best.zdiff = zdiff;
+                    best.pos = pos;
+                    best.column = column;
+                }
+            }
+        };
+
+        const auto probe = [&](int i, int j) {
+            auto column = this->columns.find( std::make_pair(i, j) );
+            if (column != this->columns.end())
+                consider(column, (i - oi) * (i - oi) + (j - oj) * (j - oj));
+        };
+
+        size_t lookups = 0;
+        for (int r = 0; ; ++r) {
+            // Every column in ring r is at least r*r away.
+            if (best.pos != std::numeric_limits<size_t>::max() && r * r > best.ijdist2)
+                break;
+
+            const size_t ring_size = (r == 0) ? 1 : 8 * r;
+            if (lookups + ring_size > this->remaining) {
+                for (auto column = this->columns.begin(); column != this->columns.end(); ++column) {
+                    const int ci = column->first.first;
+                    const int cj = column->first.second;
+                    consider(column, (ci - oi) * (ci - oi) + (cj - oj) * (cj - oj));
+                }
+                break;
+            }
+            lookups += ring_size;
+
+            if (r == 0) {
+                probe(oi, oj);
+                continue;
+            }
+
+            for (int d = -r; d <= r; ++d) {
+                probe(oi + d, oj - r);
+                probe(oi + d, oj + r);
+            }
+            for (int d = -r + 1; d < r; ++d) {
+                probe(oi - r, oj + d);
+                probe(oi + r, oj + d);
+            }
+        }
+        assert(best.pos != std::numeric_limits<size_t>::max());
+
+        auto& column = best.column->second;
+        column.erase( std::find(column.begin(), column.end(), this->id_at[best.pos]) );
+        if (column.empty())
+            this->columns.erase( best.column );
+        this->remaining -= 1;
+
+        std::swap(connections[best.pos], connections[start_pos]);
+        std::swap(this->id_at[best.pos], this->id_at[start_pos]);
+        this->pos_of[ this->id_at[best.pos] ] = best.pos;
+        this->pos_of[ this->id_at[start_pos] ] = start_pos;
+    }
+
+}
+
     WellConnections::WellConnections(int headIArg, int headJArg) :
         headI(headIArg),
         headJ(headJArg)
@@ -228,58 +360,21 @@ namespace Opm {
             return;
         }
 
+        ColumnIndex index( this->m_connections );
+
         // Find the first connection and swap it into the 0-position.
         const double surface_z = 0.0;
-        size_t first_index = findClosestConnection(well_i, well_j, surface_z, 0);
-        std::swap(m_connections[first_index], m_connections[0]);
+        index.moveClosest(well_i, well_j, surface_z, 0, this->m_connections);
 
         // Repeat for remaining connections.
-        //
-        // Note that since findClosestConnection() is O(n), this is an
-        // O(n^2) algorithm. However, it should be acceptable since
-        // the expected number of connections is fairly low (< 100).
-
-        if( this->m_connections.empty() ) return;
-
         for (size_t pos = 1; pos < m_connections.size() - 1; ++pos) {
             const auto& prev = m_connections[pos - 1];
             const double prevz = prev.center_depth;
-            size_t next_index = findClosestConnection(prev.getI(), prev.getJ(), prevz, pos);
-            std::swap(m_connections[next_index], m_connections[pos]);
+            index.moveClosest(prev.getI(), prev.getJ(), prevz, pos, this->m_connections);
         }
     }
 
 
-
-    size_t WellConnections::findClosestConnection(int oi, int oj, double oz, size_t start_pos)
-    {
-        size_t closest = std::numeric_limits<size_t>::max();
-        int min_ijdist2 = std::numeric_limits<int>::max();
-        double min_zdiff = std::numeric_limits<double>::max();
-        for (size_t pos = start_pos; pos < m_connections.size(); ++pos) {
-            const auto& connection = m_connections[ pos ];
-
-            const double depth = connection.center_depth;
-            const int ci = connection.getI();
-            const int cj = connection.getJ();
-            // Using square of distance to avoid non-integer arithmetics.
-            const int ijdist2 = (ci - oi) * (ci - oi) + (cj - oj) * (cj - oj);
-            if (ijdist2 < min_ijdist2) {
-                min_ijdist2 = ijdist2;
-                min_zdiff = std::abs(depth - oz);
-                closest = pos;
-            } else if (ijdist2 == min_ijdist2) {
-                const double zdiff = std::abs(depth - oz);
-                if (zdiff < min_zdiff) {
-                    min_zdiff = zdiff;
-                    closest = pos;
-                }
-            }
-        }
-        assert(closest != std::numeric_limits<size_t>::max());
-        return closest;
-    }
-
     bool WellConnections::operator==( const WellConnections& rhs ) const {
         return this->size() == rhs.size()
             && std::equal( this->begin(), this->end(), rhs.begin() );
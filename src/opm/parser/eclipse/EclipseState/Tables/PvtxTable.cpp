@@ -17,6 +17,8 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+
 #include <opm/parser/eclipse/Deck/DeckItem.hpp>
 #include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/parser/eclipse/Deck/DeckRecord.hpp>
@@ -68,6 +70,74 @@ namespace Opm {
                 m_saturatedTable.addRow( row );
             }
         }
+
+        packUnderSaturatedTables();
+    }
+
+
+    void PvtxTable::packUnderSaturatedTables() {
+        m_packedOffset.assign( 1 , 0 );
+        for (const auto& table : m_underSaturatedTables)
+            m_packedOffset.push_back( m_packedOffset.back() + table.numRows() );
+
+        const size_t numRows = m_packedOffset.back();
+        const size_t numColumns = m_underSaturatedSchema.size();
+        m_packedColumns.resize( numColumns * numRows );
+        for (size_t tableNumber = 0; tableNumber < m_underSaturatedTables.size(); tableNumber++) {
+            const auto& table = m_underSaturatedTables[ tableNumber ];
+            for (size_t columnIndex = 0; columnIndex < numColumns; columnIndex++) {
+                const auto& column = table.getColumn( columnIndex );
+                std::copy( column.begin() , column.end() ,
+                           m_packedColumns.begin() + columnIndex * numRows + m_packedOffset[ tableNumber ] );
+            }
+        }
+
+        m_packedDescending = m_underSaturatedSchema.getColumn( 0 ).isDecreasing();
+    }
+
+
+    void PvtxTable::assertColumnIndex(size_t columnIndex) const {
+        if (columnIndex >= m_underSaturatedSchema.size())
+            throw std::invalid_argument("Invalid column index: " + std::to_string( columnIndex ) + " max: " + std::to_string( m_underSaturatedSchema.size() - 1 ));
+    }
+
+
+    /*
+      Equivalent to getUnderSaturatedTable( tableNumber ).evaluate( columnIndex, innerArg ),
+      i.e. linear interpolation with constant extrapolation, but working
+      on the packed storage. The argument column is strictly monotone.
+    */
+    double PvtxTable::evaluateUnderSaturated(size_t tableNumber, size_t columnIndex, double innerArg) const {
+        const size_t numRows = m_packedOffset.back();
+        const auto argBegin = m_packedColumns.begin() + m_packedOffset[ tableNumber ];
+        const auto argEnd = m_packedColumns.begin() + m_packedOffset[ tableNumber + 1 ];
+        const double * values = m_packedColumns.data() + columnIndex * numRows + m_packedOffset[ tableNumber ];
+        const size_t size = argEnd - argBegin;
+
+        if (size == 1)
+            return values[0];
+
+        size_t index;
+        if (m_packedDescending) {
+            if (innerArg >= argBegin[0])
+                return values[0];
+
+            if (innerArg <= argBegin[size - 1])
+                return values[size - 1];
+
+            index = std::partition_point( argBegin , argEnd , [innerArg](double arg) { return arg >= innerArg; }) - argBegin - 1;
+        } else {
+            if (innerArg <= argBegin[0])
+                return values[0];
+
+            if (innerArg >= argBegin[size - 1])
+                return values[size - 1];
+
+            index = std::partition_point( argBegin , argEnd , [innerArg](double arg) { return arg < innerArg; }) - argBegin - 1;
+        }
+
+        const double weight1 = 1 - (innerArg - argBegin[index])/(argBegin[index + 1] - argBegin[index]);
+        return values[index] * weight1 + (1 - weight1) * values[index + 1];
     }
 
 
@@ -89,6 +159,49 @@ namespace Opm {
     }
 
 
+    double PvtxTable::evaluate(size_t columnIndex, double outerArg, double innerArg) const
+    {
+        assertColumnIndex( columnIndex );
+
+        TableIndex outerIndex = m_outerColumn.lookup( outerArg );
+        double weight1 = outerIndex.getWeight1( );
+        double value = weight1 * evaluateUnderSaturated( outerIndex.getIndex1( ) , columnIndex , innerArg );
+
+        if (weight1 < 1)
+            value += outerIndex.getWeight2( ) * evaluateUnderSaturated( outerIndex.getIndex2( ) , columnIndex , innerArg );
+
+        return value;
+    }
+
+
+    std::vector<double> PvtxTable::evaluate(size_t columnIndex,
+                                            const std::vector<double>& outerArgs,
+                                            const std::vector<double>& innerArgs) const
+    {
+        if (outerArgs.size() != innerArgs.size())
+            throw std::invalid_argument("Size mismatch between outer and inner arguments");
+
+        assertColumnIndex( columnIndex );
+
+        std::vector<double> values;
+        values.reserve( outerArgs.size() );
+
+        size_t hint = 0;
+        for (size_t i = 0; i < outerArgs.size(); i++) {
+            const auto outerIndex = m_outerColumn.lookup( outerArgs[i] , hint );
+            const double weight1 = outerIndex.getWeight1( );
+            double value = weight1 * evaluateUnderSaturated( outerIndex.getIndex1( ) , columnIndex , innerArgs[i] );
+
+            if (weight1 < 1)
+                value += outerIndex.getWeight2( ) * evaluateUnderSaturated( outerIndex.getIndex2( ) , columnIndex , innerArgs[i] );
+
+            values.push_back( value );
+        }
+
+        return values;
+    }
+
+
     const SimpleTable& PvtxTable::getSaturatedTable() const {
         return this->m_saturatedTable;
     }
@@ -146,6 +146,15 @@ namespace Opm {
         return valueColumn.eval( index );
     }
 
+    double SimpleTable::evaluate(size_t columnIndex, double xPos) const
+    {
+        const auto& argColumn = getColumn( 0 );
+        const auto& valueColumn = getColumn( columnIndex );
+
+        const auto index = argColumn.lookup( xPos );
+        return valueColumn.eval( index );
+    }
+
     void SimpleTable::assertJFuncPressure(const bool jf) const {
         if (jf == m_jfunc)
             return;
@@ -24,10 +24,59 @@
 
 #include <ert/util/ssize_t.h>
 
+namespace {
+
+    /*
+      In an ordered column the values 'before' argValue form a prefix
+      of the column: values < argValue for an increasing column and
+      values >= argValue for a decreasing column. The interval holding
+      argValue starts at the last element of that prefix.
+    */
+    template <bool Descending>
+    bool before( double value , double argValue ) {
+        return Descending ? (value >= argValue) : (value < argValue);
+    }
+
+
+    template <bool Descending>
+    bool inInterval( const std::vector<double>& values , size_t intervalIdx , double argValue ) {
+        return (intervalIdx + 1 < values.size())
+            && before<Descending>( values[intervalIdx] , argValue )
+            && !before<Descending>( values[intervalIdx + 1] , argValue );
+    }
+
+
+    /*
+      Requires argValue strictly between the column extrema, so that the
+      result is in the range [0, size - 2].
+    */
+    template <bool Descending>
+    size_t findInterval( const std::vector<double>& values , double argValue ) {
+        const auto iter = std::partition_point( values.begin() , values.end() ,
+                                                [argValue]( double value ) { return before<Descending>( value , argValue ); });
+        const size_t count = iter - values.begin();
+        return (count > 0) ? count - 1 : 0;
+    }
+
+
+    template <bool Descending>
+    size_t findInterval( const std::vector<double>& values , double argValue , size_t hint ) {
+        if (inInterval<Descending>( values , hint , argValue ))
+            return hint;
+
+        if (inInterval<Descending>( values , hint + 1 , argValue ))
+            return hint + 1;
+
+        return findInterval<Descending>( values , argValue );
+    }
+
+}
+
 namespace Opm {
 
     TableColumn::TableColumn(const ColumnSchema& schema) :
-        m_schema( schema )
+        m_schema( schema ),
+        m_name( schema.name() )
     {
         m_defaultCount = 0;
     }
@@ -82,6 +131,7 @@ namespace Opm {
         assertUpdate( m_values.size() , value );
         m_values.push_back( value );
         m_default.push_back( false );
+        updateExtrema( );
     }
 
 
@@ -107,6 +157,31 @@ namespace Opm {
             m_default[index] = false;
             m_defaultCount -= 1;
         }
+        updateExtrema( );
+    }
+
+
+    void TableColumn::updateExtrema() {
+        if (!m_schema.lookupValid( ) || hasDefault( ) || m_values.empty( ))
+            return;
+
+        /*
+          The column is ordered, i.e. the extrema are found at the ends;
+          for weakly ordered columns the index of the first occurence is
+          found by bisection.
+        */
+        const double last = m_values.back( );
+        if (m_schema.isDecreasing( )) {
+            const auto iter = std::partition_point( m_values.begin() , m_values.end() ,
+                                                    [last]( double value ) { return value > last; });
+            m_maxIndex = 0;
+            m_minIndex = iter - m_values.begin();
+        } else {
+            const auto iter = std::partition_point( m_values.begin() , m_values.end() ,
+                                                    [last]( double value ) { return value < last; });
+            m_minIndex = 0;
+            m_maxIndex = iter - m_values.begin();
+        }
     }
 
     bool TableColumn::defaultApplied(size_t index) const {
@@ -138,20 +213,26 @@ namespace Opm {
     double TableColumn::max( ) const {
         if (hasDefault())
             throw std::invalid_argument("Can not lookup elements in a column with defaulted values.");
-        if (m_values.size() > 0)
-            return *std::max_element( m_values.begin() , m_values.end());
-        else
+        if (m_values.empty())
             throw std::invalid_argument("Can not find max in empty column");
+
+        if (m_schema.lookupValid( ))
+            return m_values[m_maxIndex];
+
+        return *std::max_element( m_values.begin() , m_values.end());
     }
 
 
     double TableColumn::min( ) const {
         if (hasDefault())
             throw std::invalid_argument("Can not lookup elements in a column with defaulted values.");
-        if (m_values.size() > 0)
-            return *std::min_element( m_values.begin() , m_values.end());
-        else
+        if (m_values.empty())
             throw std::invalid_argument("Can not find max in empty column");
+
+        if (m_schema.lookupValid( ))
+            return m_values[m_minIndex];
+
+        return *std::min_element( m_values.begin() , m_values.end());
     }
 
 
@@ -170,7 +251,7 @@ namespace Opm {
     }
 
 
-    TableIndex TableColumn::lookup( double argValue ) const {
+    void TableColumn::assertLookup() const {
         if (!m_schema.lookupValid( ))
             throw std::invalid_argument("Must have an ordered column to perform table argument lookup.");
 
@@ -179,47 +260,58 @@ namespace Opm {
 
         if (hasDefault())
             throw std::invalid_argument("Can not lookup elements in a column with defaulted values.");
+    }
 
-        if (argValue >= max()) {
-            const auto max_iter = std::max_element( m_values.begin() , m_values.end());
-            const size_t max_index = max_iter - m_values.begin();
-            return TableIndex( max_index , 1.0 );
-        }
 
-        if (argValue <= min()) {
-            const auto min_iter = std::min_element( m_values.begin() , m_values.end());
-            const size_t min_index = min_iter - m_values.begin();
-            return TableIndex( min_index , 1.0 );
-        }
+    TableIndex TableColumn::intervalIndex( size_t intervalIdx , double argValue ) const {
+        const double weight1 = 1 - (argValue - m_values[intervalIdx])/(m_values[intervalIdx + 1] - m_values[intervalIdx]);
+        return TableIndex( intervalIdx , weight1 );
+    }
 
-        {
-            bool isDescending = m_schema.isDecreasing( );
-            size_t lowIntervalIdx = 0;
-            size_t intervalIdx = (size() - 1)/2;
-            size_t highIntervalIdx = size() - 1;
-            double weight1;
-
-            while (lowIntervalIdx + 1 < highIntervalIdx) {
-                if (isDescending) {
-                    if (m_values[intervalIdx] < argValue)
-                        highIntervalIdx = intervalIdx;
-                    else
-                        lowIntervalIdx = intervalIdx;
-                }
-                else {
-                    if (m_values[intervalIdx] < argValue)
-                        lowIntervalIdx = intervalIdx;
-                    else
-                        highIntervalIdx = intervalIdx;
-                }
 
-                intervalIdx = (highIntervalIdx + lowIntervalIdx)/2;
-            }
+    TableIndex TableColumn::lookup( double argValue ) const {
+        assertLookup( );
 
-            weight1 = 1 - (argValue - m_values[intervalIdx])/(m_values[intervalIdx + 1] - m_values[intervalIdx]);
+        if (argValue >= m_values[m_maxIndex])
+            return TableIndex( m_maxIndex , 1.0 );
 
-            return TableIndex( intervalIdx , weight1 );
-        }
+        if (argValue <= m_values[m_minIndex])
+            return TableIndex( m_minIndex , 1.0 );
+
+        const size_t intervalIdx = m_schema.isDecreasing( )
+            ? findInterval<true>( m_values , argValue )
+            : findInterval<false>( m_values , argValue );
+
+        return intervalIndex( intervalIdx , argValue );
+    }
+
+
+    TableIndex TableColumn::lookup( double argValue , size_t& hint ) const {
+        assertLookup( );
+
+        if (argValue >= m_values[m_maxIndex])
+            return TableIndex( m_maxIndex , 1.0 );
+
+        if (argValue <= m_values[m_minIndex])
+            return TableIndex( m_minIndex , 1.0 );
+
+        hint = m_schema.isDecreasing( )
+            ? findInterval<true>( m_values , argValue , hint )
+            : findInterval<false>( m_values , argValue , hint );
+
+        return intervalIndex( hint , argValue );
+    }
+
+
+    std::vector<TableIndex> TableColumn::lookup( const std::vector<double>& argValues ) const {
+        std::vector<TableIndex> indices;
+        indices.reserve( argValues.size() );
+
+        size_t hint = 0;
+        for (const double argValue : argValues)
+            indices.push_back( lookup( argValue , hint ));
+
+        return indices;
     }
 
     std::vector<double>::const_iterator TableColumn::begin() const {
@@ -251,6 +343,17 @@ namespace Opm {
     }
 
 
+    std::vector<double> TableColumn::eval( const std::vector<TableIndex>& indices) const {
+        std::vector<double> values;
+        values.reserve( indices.size() );
+
+        for (const auto& index : indices)
+            values.push_back( eval( index ));
+
+        return values;
+    }
+
+
     TableColumn& TableColumn::operator= (const TableColumn& other) {
         if (this != &other) {
             m_schema = other.m_schema;
@@ -258,6 +361,8 @@ namespace Opm {
             m_values = other.m_values;
             m_default = other.m_default;
             m_defaultCount = other.m_defaultCount;
+            m_minIndex = other.m_minIndex;
+            m_maxIndex = other.m_maxIndex;
         }
         return *this;
     }
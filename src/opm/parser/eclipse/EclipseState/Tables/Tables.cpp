@@ -1118,7 +1118,7 @@ MsfnTable::MsfnTable( const DeckItem& item ) {
 
     SimpleTable::init( item );
 
-    getColumn("GasPhaseFraction").assertUnitRange();
+    getColumn(Column::GasPhaseFraction).assertUnitRange();
 }
 
 
@@ -17,6 +17,9 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cmath>
+#include <limits>
+#include <random>
 #include <stdexcept>
 #include <iostream>
 #include <boost/filesystem.hpp>
@@ -154,3 +157,73 @@ BOOST_AUTO_TEST_CASE(ActiveCompletions) {
     BOOST_CHECK_EQUAL( completion2, active_completions.get(0));
     BOOST_CHECK_EQUAL( completion3, active_completions.get(1));
 }
+
+
+namespace {
+
+    /*
+      The straightforward O(n^2) TRACK ordering; WellConnections::orderConnections()
+      must give exactly the same order.
+    */
+    void reference_order(std::vector<Opm::Connection>& connections, int well_i, int well_j) {
+        const auto closest = [&connections](int oi, int oj, double oz, size_t start_pos) {
+            size_t best = start_pos;
+            int min_ijdist2 = std::numeric_limits<int>::max();
+            double min_zdiff = std::numeric_limits<double>::max();
+            for (size_t pos = start_pos; pos < connections.size(); ++pos) {
+                const auto& c = connections[pos];
+                const int ijdist2 = (c.getI() - oi) * (c.getI() - oi) + (c.getJ() - oj) * (c.getJ() - oj);
+                const double zdiff = std::abs(c.center_depth - oz);
+                if (ijdist2 < min_ijdist2 || (ijdist2 == min_ijdist2 && zdiff < min_zdiff)) {
+                    min_ijdist2 = ijdist2;
+                    min_zdiff = zdiff;
+                    best = pos;
+                }
+            }
+            return best;
+        };
+
+        std::swap(connections[closest(well_i, well_j, 0.0, 0)], connections[0]);
+        for (size_t pos = 1; pos + 1 < connections.size(); ++pos) {
+            const auto& prev = connections[pos - 1];
+            std::swap(connections[closest(prev.getI(), prev.getJ(), prev.center_depth, pos)], connections[pos]);
+        }
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE(OrderConnectionsTrack) {
+    const auto dir = Opm::WellCompletion::DirectionEnum::Z;
+    std::mt19937 gen(42);
+
+    for (int trial = 0; trial < 50; ++trial) {
+        const int nx = 1 + trial % 7;
+        const int ny = 1 + (trial * 3) % 40;
+        const int num_connections = 1 + (trial * 37) % 300;
+        std::uniform_int_distribution<int> random_i(0, nx - 1);
+        std::uniform_int_distribution<int> random_j(0, ny - 1);
+        std::uniform_int_distribution<int> random_k(0, 20);
+
+        Opm::WellConnections connections(nx / 2, 0);
+        std::vector<Opm::Connection> expected;
+        for (int c = 0; c < num_connections; ++c) {
+            const int k = random_k(gen);
+            // Depths repeat, so that ties on depth are exercised as well.
+            Opm::Connection connection( random_i(gen), random_j(gen), k, 1, 1000.0 + 2.5 * (k % 10),
+                                        Opm::WellCompletion::OPEN,
+                                        Opm::Value<double>("ConnectionTransmissibilityFactor", c),
+                                        Opm::Value<double>("D", 0.2), Opm::Value<double>("SKIN", 0.0),
+                                        Opm::Value<double>("Kh", 1.0), 0, dir );
+            connections.add( connection );
+            expected.push_back( connection );
+        }
+
+        connections.orderConnections(nx / 2, 0);
+        reference_order(expected, nx / 2, 0);
+
+        BOOST_REQUIRE_EQUAL( expected.size(), connections.size() );
+        for (size_t pos = 0; pos < expected.size(); ++pos)
+            BOOST_CHECK_EQUAL( expected[pos].getConnectionTransmissibilityFactor(),
+                               connections.get(pos).getConnectionTransmissibilityFactor() );
+    }
+}
@@ -17,7 +17,9 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <stdexcept>
+#include <vector>
 #include <iostream>
 #include <boost/filesystem.hpp>
 
@@ -273,3 +275,53 @@ BOOST_AUTO_TEST_CASE( update_elm ) {
     BOOST_CHECK_EQUAL( state[3],90  );
     BOOST_CHECK_EQUAL( state[4],139 );
 }
+
+
+BOOST_AUTO_TEST_CASE( change_points ) {
+    const std::time_t startDate = Opm::TimeMap::mkdate(2010, 1, 1);
+    Opm::TimeMap timeMap{ startDate };
+    for (size_t i = 0; i < 20; i++)
+        timeMap.addTStep((i+1) * 24 * 60 * 60);
+
+    // Apply the same pseudo-random sequence of operations to a
+    // DynamicState and to a plain vector with one element per step.
+    Opm::DynamicState<int> state(timeMap , 0);
+    std::vector<int> expected( timeMap.size() , 0 );
+    size_t initial_range = expected.size();
+    unsigned int seed = 7;
+    for (int iter = 0; iter < 500; iter++) {
+        seed = seed * 1103515245 + 12345;
+        const size_t index = (seed >> 8) % expected.size();
+        const int value = (seed >> 20) % 4;
+
+        switch ((seed >> 16) % 3) {
+        case 0:
+            if (initial_range == expected.size())
+                initial_range = index;
+            BOOST_CHECK_EQUAL( state.update( index , value ) , value != expected[index] );
+            if (value != expected[index])
+                std::fill( expected.begin() + index , expected.end() , value );
+            break;
+        case 1:
+            state.update_elm( index , value );
+            expected[index] = value;
+            break;
+        default:
+            state.updateInitial( value );
+            std::fill( expected.begin() , expected.begin() + initial_range , value );
+            break;
+        }
+
+        for (size_t step = 0; step < expected.size(); step++)
+            BOOST_CHECK_EQUAL( state[step] , expected[step] );
+        BOOST_CHECK_EQUAL( state.back() , expected.back() );
+
+        for (int v = 0; v < 4; v++) {
+            const auto iter = std::find( expected.begin() , expected.end() , v );
+            const int first = (iter == expected.end()) ? -1 : std::distance( expected.begin() , iter );
+            BOOST_CHECK_EQUAL( state.find( v ) , first );
+        }
+    }
+
+    BOOST_CHECK_THROW( state.at( expected.size() ) , std::out_of_range );
+}
@@ -77,6 +77,23 @@ BOOST_AUTO_TEST_CASE(CreateFace) {
 }
 
 
+BOOST_AUTO_TEST_CASE(FaceBoxIteration) {
+    Opm::FaultFace face(4,3,3, 2 , 2  , 1 , 2 , 0 , 1 , Opm::FaceDir::XPlus);
+    std::vector<size_t> trueValues{6, 10, 18, 22};
+    std::vector<size_t> values( face.begin() , face.end() );
+
+    BOOST_CHECK_EQUAL( face.size() , 4U );
+    BOOST_CHECK_EQUAL_COLLECTIONS( values.begin() , values.end() , trueValues.begin() , trueValues.end() );
+
+    std::vector<double> data( 4*3*3 , 1.0 );
+    face.multiply( data.data() , 0.5 , 1 , 3 );
+    for (size_t g = 0; g < data.size(); g++) {
+        const double expected = (g == 18 || g == 22) ? 0.5 : 1.0;
+        BOOST_CHECK_EQUAL( data[g] , expected );
+    }
+}
+
+
 BOOST_AUTO_TEST_CASE(CreateFault) {
     Opm::Fault fault("FAULT1");
     BOOST_CHECK_EQUAL( "FAULT1" , fault.getName());
@@ -396,6 +396,58 @@ BOOST_AUTO_TEST_CASE(UpdateTree_AddFieldNode_Throws) {
     BOOST_CHECK_THROW(tree.update("FIELD"), std::invalid_argument );
 }
 
+BOOST_AUTO_TEST_CASE(GroupTree_IdsAndSiblings) {
+    GroupTree tree;
+    tree.update("P2", "FIELD");
+    tree.update("C", "P1");
+    tree.update("B", "P1");
+    tree.update("A", "P2");
+
+    BOOST_CHECK_EQUAL( 6U, tree.size() );
+    BOOST_CHECK_EQUAL( 0, tree.groupId( "FIELD" ) );
+    BOOST_CHECK_EQUAL( -1, tree.parentId( 0 ) );
+    BOOST_CHECK_EQUAL( "", tree.parent( "FIELD" ) );
+    BOOST_CHECK_THROW( tree.groupId( "NO_SUCH_GROUP" ), std::out_of_range );
+
+    const int p1 = tree.groupId( "P1" );
+    BOOST_CHECK_EQUAL( "P1", tree.groupName( p1 ) );
+    BOOST_CHECK_EQUAL( 0, tree.parentId( p1 ) );
+
+    // Children are linked in name order, whatever the insertion order.
+    BOOST_CHECK_EQUAL( p1, tree.firstChild( 0 ) );
+    BOOST_CHECK_EQUAL( tree.groupId( "P2" ), tree.nextSibling( p1 ) );
+    BOOST_CHECK_EQUAL( -1, tree.nextSibling( tree.groupId( "P2" ) ) );
+    const std::vector< std::string > p1_children = { "B", "C" };
+    BOOST_CHECK( tree.children( "P1" ) == p1_children );
+
+    // Moving a group keeps its id, and a copy keeps all ids.
+    auto copy = tree;
+    const int b = tree.groupId( "B" );
+    copy.update( "B", "P2" );
+    BOOST_CHECK_EQUAL( b, copy.groupId( "B" ) );
+    BOOST_CHECK_EQUAL( "P2", copy.parent( "B" ) );
+    const std::vector< std::string > p2_children = { "A", "B" };
+    BOOST_CHECK( copy.children( "P2" ) == p2_children );
+    BOOST_CHECK( copy.children( "P1" ) == std::vector< std::string >{ "C" } );
+    BOOST_CHECK( copy != tree );
+
+    copy.update( "B", "P1" );
+    BOOST_CHECK( copy == tree );
+}
+
+BOOST_AUTO_TEST_CASE(GroupTree_EqualityIgnoresIds) {
+    GroupTree tree1;
+    tree1.update("B", "FIELD");
+    tree1.update("A", "FIELD");
+    tree1.update("B", "A");
+
+    GroupTree tree2;
+    tree2.update("B", "A");
+
+    BOOST_CHECK( tree1 == tree2 );
+    BOOST_CHECK( tree1.groupId( "A" ) != tree2.groupId( "A" ) );
+}
+
 BOOST_AUTO_TEST_CASE(createDeckWithGRUPNET) {
         Opm::Parser parser;
         std::string input =
@@ -39,6 +39,7 @@
 #include <opm/parser/eclipse/EclipseState/Grid/GridProperty.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/Box.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/FaceDir.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/TransMult.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/TableManager.hpp>
 
 
@@ -264,3 +265,83 @@ BOOST_AUTO_TEST_CASE(MULTREGT_COPY_MULTNUM) {
         BOOST_CHECK_EQUAL(fdata[i], data[i]);
     }
 }
+
+
+static Opm::Deck createFaceMultiplierDeck(const std::string& multnum, const std::string& multregt) {
+    const std::string deckData =
+        "RUNSPEC\n"
+        "\n"
+        "DIMENS\n"
+        "2 2 2 /\n"
+        "GRID\n"
+        "DX\n"
+        "8*0.25 /\n"
+        "DY\n"
+        "8*0.25 /\n"
+        "DZ\n"
+        "8*0.25 /\n"
+        "TOPS\n"
+        "4*0.25 /\n"
+        "MULTNUM\n"
+        + multnum +
+        "/\n"
+        "MULTX\n"
+        "8*3.0 /\n"
+        "MULTREGT\n"
+        + multregt +
+        "/\n"
+        "EDIT\n"
+        "\n";
+
+    Opm::Parser parser;
+    return parser.parseString(deckData, Opm::ParseContext()) ;
+}
+
+BOOST_AUTO_TEST_CASE(MULTREGT_FACE_MULTIPLIERS) {
+    Opm::Deck deck = createFaceMultiplierDeck( "1 2 1 2 3 4 3 4\n",
+                                               "1  2   0.50  XYZ  ALL  M /\n"
+                                               "3  4   2.00  X    ALL  M /\n"
+                                               "2  4   4.00  Z    ALL  M /\n" );
+    Opm::TableManager tm(deck);
+    Opm::EclipseGrid eg(deck);
+    Opm::Eclipse3DProperties props(deck, tm, eg);
+    Opm::TransMult transMult( eg, deck, props );
+    transMult.applyMULT( props.getDoubleGridProperty("MULTX"), Opm::FaceDir::XPlus );
+
+    const std::vector<double> expectedX = { 1.5, 1, 1.5, 1, 6, 1, 6, 1 };
+    const std::vector<double> expectedY = { 1, 1, 1, 1, 1, 1, 1, 1 };
+    const std::vector<double> expectedZ = { 1, 4, 1, 4, 1, 1, 1, 1 };
+
+    const auto multX = transMult.getFaceMultipliers( Opm::FaceDir::XPlus );
+    const auto multY = transMult.getFaceMultipliers( Opm::FaceDir::YPlus );
+    const auto multZ = transMult.getFaceMultipliers( Opm::FaceDir::ZPlus );
+    BOOST_CHECK_EQUAL_COLLECTIONS( multX.begin(), multX.end(), expectedX.begin(), expectedX.end() );
+    BOOST_CHECK_EQUAL_COLLECTIONS( multY.begin(), multY.end(), expectedY.begin(), expectedY.end() );
+    BOOST_CHECK_EQUAL_COLLECTIONS( multZ.begin(), multZ.end(), expectedZ.begin(), expectedZ.end() );
+
+    for (size_t g = 0; g < 8; g += 2) {
+        double mult = transMult.getMultiplier( g, Opm::FaceDir::XPlus )
+                    * transMult.getMultiplier( g + 1, Opm::FaceDir::XMinus )
+                    * transMult.getRegionMultiplier( g, g + 1, Opm::FaceDir::XPlus );
+        BOOST_CHECK_EQUAL( mult, multX[g] );
+    }
+
+    BOOST_CHECK_THROW( transMult.getFaceMultipliers( Opm::FaceDir::XMinus ), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_CASE(MULTREGT_SPARSE_REGIONS) {
+    Opm::Deck deck = createFaceMultiplierDeck( "1 5000 1 5000 -7 5000 -7 5000\n",
+                                               "1    5000   0.50  XYZ  ALL  M /\n"
+                                               "5000  -7    0.25  XYZ  ALL  M /\n" );
+    Opm::TableManager tm(deck);
+    Opm::EclipseGrid eg(deck);
+    Opm::Eclipse3DProperties props(deck, tm, eg);
+    std::vector<const Opm::DeckKeyword*> keywords = { &deck.getKeyword( "MULTREGT" ) };
+    Opm::MULTREGTScanner scanner( props, keywords );
+
+    BOOST_CHECK_EQUAL( 0.50, scanner.getRegionMultiplier( 0, 1, Opm::FaceDir::XPlus ));
+    BOOST_CHECK_EQUAL( 0.50, scanner.getRegionMultiplier( 1, 0, Opm::FaceDir::XMinus ));
+    BOOST_CHECK_EQUAL( 0.25, scanner.getRegionMultiplier( 4, 5, Opm::FaceDir::XPlus ));
+    BOOST_CHECK_EQUAL( 1.00, scanner.getRegionMultiplier( 0, 2, Opm::FaceDir::YPlus ));
+    BOOST_CHECK_EQUAL( 1.00, scanner.getRegionMultiplier( 0, 4, Opm::FaceDir::ZPlus ));
+}
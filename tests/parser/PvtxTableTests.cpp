@@ -33,7 +33,7 @@
 #include <opm/parser/eclipse/EclipseState/Tables/TableManager.hpp>
 
 // keyword specific table classes
-//#include <opm/parser/eclipse/EclipseState/Tables/PvtoTable.hpp>
+#include <opm/parser/eclipse/EclipseState/Tables/PvtoTable.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/SwofTable.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/SgofTable.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/PlyadsTable.hpp>
@@ -183,6 +183,88 @@ BOOST_AUTO_TEST_CASE( PVTGSaturatedTable ) {
     BOOST_CHECK_EQUAL( saturatedTable.get(1 , 1) , 0.00000628 );
 }
 
+BOOST_AUTO_TEST_CASE( PVTOPackedEvaluate ) {
+    const char *deckData =
+        "TABDIMS\n"
+        "1 2 /\n"
+        "\n"
+        "PVTO\n"
+        " 20.59  50.00  1.10615 1.180\n"
+        "        75.00  1.10164 1.247\n"
+        "       100.00  1.09744 1.315 /\n"
+        " 28.19  70.00  1.12522 1.066\n"
+        "        95.00  1.12047 1.124 /\n"
+        "/\n"
+        " 404.60 594.29 1.97527 0.21564\n"
+        "        619.29 1.96301 0.21981 /\n"
+        " 420.00 600.00 1.98000 0.20000\n"
+        "        650.00 1.96000 0.21000 /\n"
+        "/\n";
+
+    Opm::Parser parser;
+    auto deck = parser.parseString(deckData, Opm::ParseContext());
+    Opm::TableManager tableManager(deck);
+    const auto& pvtoTables = tableManager.getPvtoTables( );
+    BOOST_CHECK_EQUAL( pvtoTables.size() , 2U );
+
+    const std::vector<std::string> columns = { "P", "BO", "MU" };
+    std::vector<int> tableIdx;
+    std::vector<double> outerArgs;
+    std::vector<double> innerArgs;
+    std::vector<double> expected;
+    for (size_t t = 0; t < pvtoTables.size(); t++) {
+        const auto& table = pvtoTables[t];
+        const double rsMin = table.getArgValue( 0 );
+        const double rsMax = table.getArgValue( table.size() - 1 );
+        for (int i = -2; i <= 22; i++) {
+            const double rs = rsMin + i * (rsMax - rsMin) / 20;
+            for (int j = -2; j <= 12; j++) {
+                const double p = 1.0e5 * (60 * j + 1);
+                for (size_t c = 0; c < columns.size(); c++)
+                    BOOST_CHECK_EQUAL( table.evaluate( c , rs , p ) , table.evaluate( columns[c] , rs , p ));
+
+                tableIdx.push_back( t );
+                outerArgs.push_back( rs );
+                innerArgs.push_back( p );
+                expected.push_back( table.evaluate( "BO" , rs , p ));
+            }
+        }
+
+        const auto values = table.evaluate( 2 , outerArgs , innerArgs );
+        for (size_t i = 0; i < values.size(); i++)
+            BOOST_CHECK_EQUAL( values[i] , table.evaluate( "MU" , outerArgs[i] , innerArgs[i] ));
+    }
+
+    const auto values = PvtxTable::evaluate( pvtoTables , 1 , tableIdx , outerArgs , innerArgs );
+    BOOST_CHECK_EQUAL( values.size() , expected.size() );
+    for (size_t i = 0; i < values.size(); i++)
+        BOOST_CHECK_EQUAL( values[i] , expected[i] );
+
+    BOOST_CHECK_THROW( pvtoTables[0].evaluate( 3 , 1.0 , 1.0 ) , std::invalid_argument );
+    BOOST_CHECK_THROW( PvtxTable::evaluate( pvtoTables , 1 , { 3 } , { 1.0 } , { 1.0 } ) , std::invalid_argument );
+}
+
+
+BOOST_AUTO_TEST_CASE( PVTGPackedEvaluate ) {
+    Parser parser;
+    boost::filesystem::path deckFile(prefix() + "TABLES/PVTX1.DATA");
+    ParseContext parseContext;
+    auto deck =  parser.parseFile(deckFile.string(), parseContext);
+    Opm::TableManager tables(deck);
+    const auto& pvtgTable = tables.getPvtgTables( )[0];
+
+    const double pMin = pvtgTable.getArgValue( 0 );
+    const double pMax = pvtgTable.getArgValue( pvtgTable.size() - 1 );
+    for (int i = -2; i <= 12; i++) {
+        const double p = pMin + i * (pMax - pMin) / 10;
+        for (int j = -2; j <= 12; j++) {
+            const double rv = 0.000003 * j;
+            BOOST_CHECK_EQUAL( pvtgTable.evaluate( 1 , p , rv ) , pvtgTable.evaluate( "BG" , p , rv ));
+            BOOST_CHECK_EQUAL( pvtgTable.evaluate( 2 , p , rv ) , pvtgTable.evaluate( "MUG" , p , rv ));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE( PVTWTable ) {
     const std::string input = R"(
         RUNSPEC
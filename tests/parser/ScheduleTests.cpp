@@ -531,6 +531,60 @@ BOOST_AUTO_TEST_CASE(WellsIteratorWithRegex_HasWells_WellsReturned) {
     BOOST_CHECK_EQUAL(1U, wells.size());
 }
 
+BOOST_AUTO_TEST_CASE(WellNamePatterns_InsertionOrder) {
+    Opm::Parser parser;
+    std::string input =
+            "START             -- 0 \n"
+            "10 MAI 2007 / \n"
+            "SCHEDULE\n"
+            "WELSPECS\n"
+            "     \'OP_2\'       \'G1\'   30   37  3.33       \'OIL\'  7* /   \n"
+            "     \'OP_1\'       \'G2\'   20   51  3.92       \'OIL\'  7* /   \n"
+            "     \'INJ\'        \'G1\'   10   10  3.92       \'WATER\'  7* / \n"
+            "     \'OP_10\'      \'G1\'   11   11  3.92       \'OIL\'  7* /   \n"
+            "     \'OPX\'        \'G2\'   12   12  3.92       \'OIL\'  7* /   \n"
+            "/ \n"
+            "DATES             -- 1\n"
+            " 10  \'JUN\'  2007 / \n"
+            "/\n"
+            "WCONPROD\n"
+            "     \'OP_1*\'  \'OPEN\'  \'ORAT\'  1000  /\n"
+            "/\n";
+
+    auto deck = parser.parseString(input, ParseContext());
+    EclipseGrid grid(100,100,10);
+    TableManager table ( deck );
+    Eclipse3DProperties eclipseProperties ( deck , table, grid);
+    Schedule schedule(deck, grid , eclipseProperties, Phases(true, true, true) , ParseContext());
+
+    auto names = [&schedule](const std::string& pattern) {
+        std::vector<std::string> result;
+        for (const auto* well : schedule.getWellsMatching(pattern))
+            result.push_back(well->name());
+        return result;
+    };
+
+    const std::vector<std::string> all = {"OP_2", "OP_1", "INJ", "OP_10", "OPX"};
+    const std::vector<std::string> op  = {"OP_2", "OP_1", "OP_10", "OPX"};
+    const std::vector<std::string> op_ = {"OP_2", "OP_1", "OP_10"};
+    const std::vector<std::string> op1 = {"OP_1", "OP_10"};
+
+    BOOST_CHECK( names("*") == all );
+    BOOST_CHECK( names("OP*") == op );
+    BOOST_CHECK( names("OP_*") == op_ );
+    BOOST_CHECK( names("OP_1*") == op1 );
+    BOOST_CHECK( names("OP?1*") == op1 );
+    BOOST_CHECK( names("OP_1") == std::vector<std::string>{ "OP_1" } );
+    BOOST_CHECK( names("X*").empty() );
+    BOOST_CHECK( names("").empty() );
+
+    BOOST_CHECK( schedule.getWell("OP_1")->getProductionProperties(1).OilRate > 0 );
+    BOOST_CHECK( schedule.getWell("OP_10")->getProductionProperties(1).OilRate > 0 );
+    BOOST_CHECK_EQUAL( 0.0, schedule.getWell("OP_2")->getProductionProperties(1).OilRate );
+    BOOST_CHECK_EQUAL( 0.0, schedule.getWell("OPX")->getProductionProperties(1).OilRate );
+    BOOST_CHECK_EQUAL( 3U, schedule.numGroups() );
+}
+
 BOOST_AUTO_TEST_CASE(ReturnNumWellsTimestep) {
     EclipseGrid grid(10,10,10);
     auto deck = createDeckWithWells();
@@ -680,6 +734,47 @@ BOOST_AUTO_TEST_CASE(CreateScheduleDeckWellsAndConnectionDataWithWELOPEN) {
     BOOST_CHECK_EQUAL(WellCommon::StatusEnum::SHUT, well->getStatus( 5 ));
 }
 
+BOOST_AUTO_TEST_CASE(WellViewsPerReportStep) {
+    EclipseGrid grid(10,10,10);
+    auto deck = createDeckWithWellsAndConnectionDataWithWELOPEN();
+    TableManager table ( deck );
+    Eclipse3DProperties eclipseProperties ( deck , table, grid);
+    Schedule schedule(deck ,grid , eclipseProperties, Phases(true, true, true) , ParseContext());
+
+    const auto check_views = [](const Schedule& sched) {
+        for (size_t step = 0; step < sched.getTimeMap().size(); ++step) {
+            std::vector< const Well* > defined;
+            std::vector< const Well* > open;
+            for (const auto& name : { "OP_1", "OP_2", "OP_3" }) {
+                const auto* well = sched.getWell( name );
+                if (well->hasBeenDefined( step ))
+                    defined.push_back( well );
+
+                if (well->getStatus( step ) == WellCommon::OPEN)
+                    open.push_back( well );
+            }
+
+            BOOST_CHECK( sched.getWells( step ) == defined );
+            BOOST_CHECK( sched.getOpenWells( step ) == open );
+            BOOST_CHECK_EQUAL( sched.numWells( step ), defined.size() );
+            BOOST_CHECK_EQUAL( sched.getWells( "FIELD", step ).size(), defined.size() );
+            BOOST_CHECK_EQUAL( sched.getWells( "OP", step ).size(), defined.size() );
+        }
+    };
+
+    check_views( schedule );
+    BOOST_CHECK( &schedule.getWells( 3 ) == &schedule.getWells( 5 ) );
+
+    // The views of a copy must refer to the wells of the copy.
+    Schedule copy( schedule );
+    check_views( copy );
+    for (const auto* well : copy.getWells())
+        BOOST_CHECK( well == copy.getWell( well->name() ) );
+
+    copy = schedule;
+    check_views( copy );
+}
+
 BOOST_AUTO_TEST_CASE(CreateScheduleDeckWithWELOPEN_TryToOpenWellWithShutCompletionsDoNotOpenWell) {
   Opm::Parser parser;
   std::string input =
@@ -2648,3 +2743,44 @@ BOOST_AUTO_TEST_CASE(WTEST_CONFIG) {
     BOOST_CHECK(wtest_config2.has("BAN", WellTestConfig::Reason::GROUP));
     BOOST_CHECK(!wtest_config2.has("BAN", WellTestConfig::Reason::PHYSICAL));
 }
+
+BOOST_AUTO_TEST_CASE(VFPINJ_INVALID_TABLE_THROWS) {
+    const char *deckData = "\
+START\n \
+8 MAR 1998 /\n \
+\n \
+SCHEDULE \n\
+VFPINJ \n                                       \
+-- Table Depth  Rate   TAB  UNITS  BODY    \n\
+-- ----- ----- ----- ----- ------ -----    \n\
+       5  32.9   WAT   THP METRIC   BHP /  \n\
+-- Rate axis \n\
+1 3 5 /      \n\
+-- THP axis  \n\
+7 11 /       \n\
+-- Table data with THP# <values 1-num_rates> \n\
+1 1.5 2.5 3.5 /    \n\
+2 4.5 5.5 6.5 /    \n\
+TSTEP \n\
+10 10/\n\
+VFPINJ \n                                       \
+-- Table Depth  Rate   TAB  UNITS  BODY    \n\
+-- ----- ----- ----- ----- ------ -----    \n\
+       6  100   GAS   THP FIELD   BHP /  \n\
+-- Rate axis \n\
+1 3 5 /      \n\
+-- THP axis  \n\
+7 11 /       \n\
+-- Table data with THP# <values 1-num_rates> \n\
+1 1.5 2.5 3.5 /    \n\
+2 4.5 5.5 6.5 /    \n";
+
+    Opm::Parser parser;
+    auto deck = parser.parseString(deckData, Opm::ParseContext());
+    EclipseGrid grid1(10,10,10);
+    TableManager table ( deck );
+    Eclipse3DProperties eclipseProperties ( deck , table, grid1);
+
+    // The second table is in FIELD units in a METRIC deck.
+    BOOST_CHECK_THROW( Schedule(deck, grid1 , eclipseProperties, Phases(true, true, true) , ParseContext() ), std::invalid_argument );
+}
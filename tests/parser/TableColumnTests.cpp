@@ -287,6 +287,66 @@ BOOST_AUTO_TEST_CASE( Test_EVAL_DECREASING ) {
 
 
 
+BOOST_AUTO_TEST_CASE( Test_LOOKUP_HINT ) {
+    ColumnSchema schema("COLUMN" , Table::INCREASING , Table::DEFAULT_LINEAR);
+    TableColumn column( schema );
+
+    for (double value : { 0.0, 0.0, 1.0, 2.0, 2.0, 3.0, 5.0, 8.0, 8.0 })
+        column.addValue( value );
+
+    BOOST_CHECK_EQUAL( column.min() , 0.0 );
+    BOOST_CHECK_EQUAL( column.max() , 8.0 );
+    BOOST_CHECK_EQUAL( column.lookup( 10.0 ).getIndex1() , 7U );
+    BOOST_CHECK_EQUAL( column.lookup( -1.0 ).getIndex1() , 0U );
+
+    std::vector<double> args;
+    for (int i = -5; i <= 90; i++)
+        args.push_back( 0.1 * i );
+    for (int i = 90; i >= -5; i -= 7)
+        args.push_back( 0.1 * i );
+
+    size_t hint = 0;
+    for (double arg : args) {
+        const auto plain = column.lookup( arg );
+        const auto hinted = column.lookup( arg , hint );
+        BOOST_CHECK_EQUAL( plain.getIndex1() , hinted.getIndex1() );
+        BOOST_CHECK_EQUAL( plain.getWeight1() , hinted.getWeight1() );
+    }
+
+    const auto indices = column.lookup( args );
+    const auto values = column.eval( indices );
+    BOOST_CHECK_EQUAL( indices.size() , args.size() );
+    for (size_t i = 0; i < args.size(); i++) {
+        BOOST_CHECK_EQUAL( indices[i].getIndex1() , column.lookup( args[i] ).getIndex1() );
+        BOOST_CHECK_EQUAL( values[i] , column.eval( column.lookup( args[i] )));
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE( Test_LOOKUP_HINT_DECREASING ) {
+    ColumnSchema schema("COLUMN" , Table::DECREASING , Table::DEFAULT_LINEAR);
+    TableColumn column( schema );
+
+    for (double value : { 4.0, 4.0, 3.0, 1.0, 1.0, 0.0, 0.0 })
+        column.addValue( value );
+
+    BOOST_CHECK_EQUAL( column.lookup( 5.0 ).getIndex1() , 0U );
+    BOOST_CHECK_EQUAL( column.lookup( -1.0 ).getIndex1() , 5U );
+
+    size_t hint = 3;
+    for (int i = -5; i <= 45; i++) {
+        const double arg = 0.1 * i;
+        const auto plain = column.lookup( arg );
+        const auto hinted = column.lookup( arg , hint );
+        BOOST_CHECK_EQUAL( plain.getIndex1() , hinted.getIndex1() );
+        BOOST_CHECK_EQUAL( plain.getWeight1() , hinted.getWeight1() );
+    }
+    BOOST_CHECK_CLOSE( column.eval( column.lookup( 2.0 )) , 2.0 , 1e-10 );
+}
+
+
+
+
 BOOST_AUTO_TEST_CASE( Test_CONST_DEFAULT ) {
     ColumnSchema schema("COLUMN" , Table::DECREASING , 1.0);
     TableColumn column( schema );
@@ -275,6 +275,34 @@ BOOST_AUTO_TEST_CASE(SwofTable_Tests) {
     BOOST_CHECK_EQUAL(swof2Table.getSwColumn().back(), 17.0);
 }
 
+BOOST_AUTO_TEST_CASE(SwofTable_ColumnHandles) {
+    const char *deckData =
+        "TABDIMS\n"
+        "1 /\n"
+        "\n"
+        "SWOF\n"
+        " 0.1 0.0 1.0 4\n"
+        " 0.5 0.4 0.5 2\n"
+        " 0.9 0.8 0.0 0/\n";
+
+    Opm::Parser parser;
+    auto deck = parser.parseString(deckData, Opm::ParseContext());
+    Opm::SwofTable swofTable(deck.getKeyword("SWOF").getRecord(0).getItem(0), false);
+    using Column = Opm::SwofTable::Column;
+
+    BOOST_CHECK_EQUAL( &swofTable.getColumn(Column::SW)   , &swofTable.getColumn("SW") );
+    BOOST_CHECK_EQUAL( &swofTable.getColumn(Column::KRW)  , &swofTable.getKrwColumn() );
+    BOOST_CHECK_EQUAL( &swofTable.getColumn(Column::KROW) , &swofTable.getColumn("KROW") );
+    BOOST_CHECK_EQUAL( &swofTable.getColumn(Column::PCOW) , &swofTable.getPcowColumn() );
+    BOOST_CHECK_EQUAL( swofTable.getColumn(Column::KROW).name() , "KROW" );
+
+    for (double sw : { 0.0, 0.1, 0.3, 0.5, 0.75, 0.9, 1.0 }) {
+        BOOST_CHECK_EQUAL( swofTable.evaluate(Column::KRW, sw)  , swofTable.evaluate("KRW", sw) );
+        BOOST_CHECK_EQUAL( swofTable.evaluate(Column::PCOW, sw) , swofTable.evaluate("PCOW", sw) );
+    }
+    BOOST_CHECK_CLOSE( swofTable.evaluate(Column::KROW, 0.3), 0.75, 1e-8 );
+}
+
 BOOST_AUTO_TEST_CASE(PbvdTable_Tests) {
     const char *deckData =
         "EQLDIMS\n"
@@ -1036,6 +1064,90 @@ VFPINJ \n\
 
 
 
+namespace {
+    /* A multilinear function is reproduced exactly by the interpolation. */
+    double vfpBhp(double flo, double thp, double wfr, double gfr, double alq) {
+        return 1.0e5 + 2.0 * thp + 3.0e5 * wfr - 4.0e2 * gfr - 1.0e4 * alq + 5.0e6 * flo + 10.0 * thp * flo;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(VFPProdTable_evaluate) {
+    const std::vector<double> flo = { 0.01, 0.02, 0.05 };
+    const std::vector<double> thp = { 10.0e5, 20.0e5, 40.0e5, 50.0e5 };
+    const std::vector<double> wfr = { 0.0, 0.5 };
+    const std::vector<double> gfr = { 100.0 };
+    const std::vector<double> alq = { 0.0, 1.0, 2.0 };
+
+    Opm::VFPProdTable::extents shape;
+    shape[0] = thp.size(); shape[1] = wfr.size(); shape[2] = gfr.size(); shape[3] = alq.size(); shape[4] = flo.size();
+    Opm::VFPProdTable::array_type data(shape);
+    for (size_t t = 0; t < thp.size(); ++t)
+        for (size_t w = 0; w < wfr.size(); ++w)
+            for (size_t g = 0; g < gfr.size(); ++g)
+                for (size_t a = 0; a < alq.size(); ++a)
+                    for (size_t f = 0; f < flo.size(); ++f)
+                        data[t][w][g][a][f] = vfpBhp(flo[f], thp[t], wfr[w], gfr[g], alq[a]);
+
+    Opm::VFPProdTable table(1, 1000.0, Opm::VFPProdTable::FLO_OIL, Opm::VFPProdTable::WFR_WCT,
+                            Opm::VFPProdTable::GFR_GOR, Opm::VFPProdTable::ALQ_UNDEF,
+                            flo, thp, wfr, gfr, alq, data);
+
+    std::vector<double> f_arg, t_arg, w_arg, g_arg, a_arg;
+    for (double f : { 0.0, 0.01, 0.015, 0.04, 0.07 })
+        for (double t : { 5.0e5, 10.0e5, 33.0e5, 60.0e5 })
+            for (double w : { -0.1, 0.25, 0.5 })
+                for (double a : { 0.5, 1.0, 2.5 }) {
+                    const double g = 100.0;
+                    const auto eval = table.bhp(f, t, w, g, a);
+                    BOOST_CHECK_CLOSE( eval.value , vfpBhp(f, t, w, g, a) , 1e-8 );
+                    BOOST_CHECK_CLOSE( eval.dthp , 2.0 + 10.0 * f , 1e-8 );
+                    BOOST_CHECK_CLOSE( eval.dwfr , 3.0e5 , 1e-8 );
+                    BOOST_CHECK_EQUAL( eval.dgfr , 0.0 );
+                    BOOST_CHECK_CLOSE( eval.dalq , -1.0e4 , 1e-8 );
+                    BOOST_CHECK_CLOSE( eval.dflo , 5.0e6 + 10.0 * t , 1e-8 );
+
+                    f_arg.push_back(f); t_arg.push_back(t); w_arg.push_back(w); g_arg.push_back(g); a_arg.push_back(a);
+
+                    const double thp_inv = table.thp(f, w, g, a, eval.value);
+                    BOOST_CHECK_CLOSE( thp_inv , t , 1e-6 );
+                }
+
+    const auto batch = table.bhp(f_arg, t_arg, w_arg, g_arg, a_arg);
+    BOOST_CHECK_EQUAL( batch.size() , f_arg.size() );
+    for (size_t i = 0; i < batch.size(); ++i) {
+        const auto eval = table.bhp(f_arg[i], t_arg[i], w_arg[i], g_arg[i], a_arg[i]);
+        BOOST_CHECK_EQUAL( batch[i].value , eval.value );
+        BOOST_CHECK_EQUAL( batch[i].dflo , eval.dflo );
+    }
+
+    BOOST_CHECK_THROW( table.bhp(f_arg, t_arg, w_arg, g_arg, {}) , std::invalid_argument );
+}
+
+
+BOOST_AUTO_TEST_CASE(VFPInjTable_evaluate) {
+    const std::vector<double> flo = { 0.0, 0.01, 0.05 };
+    const std::vector<double> thp = { 10.0e5, 20.0e5, 40.0e5 };
+
+    Opm::VFPInjTable::extents shape;
+    shape[0] = thp.size(); shape[1] = flo.size();
+    Opm::VFPInjTable::array_type data(shape);
+    for (size_t t = 0; t < thp.size(); ++t)
+        for (size_t f = 0; f < flo.size(); ++f)
+            data[t][f] = vfpBhp(flo[f], thp[t], 0.0, 0.0, 0.0);
+
+    Opm::VFPInjTable table(1, 1000.0, Opm::VFPInjTable::FLO_WAT, flo, thp, data);
+
+    for (double f : { -0.01, 0.0, 0.02, 0.08 })
+        for (double t : { 0.0, 10.0e5, 33.0e5, 60.0e5 }) {
+            const auto eval = table.bhp(f, t);
+            BOOST_CHECK_CLOSE( eval.value , vfpBhp(f, t, 0.0, 0.0, 0.0) , 1e-8 );
+            BOOST_CHECK_CLOSE( eval.dthp , 2.0 + 10.0 * f , 1e-8 );
+            BOOST_CHECK_CLOSE( eval.dflo , 5.0e6 + 10.0 * t , 1e-8 );
+            BOOST_CHECK_SMALL( table.thp(f, eval.value) - t , 1e-3 );
+        }
+}
+
+
 BOOST_AUTO_TEST_CASE(TestTableContainer) {
     auto deck = createSingleRecordDeck();
     Opm::TableManager tables( deck );
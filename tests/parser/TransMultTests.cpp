@@ -30,6 +30,9 @@
 #include <opm/parser/eclipse/EclipseState/Grid/TransMult.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/GridProperty.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/GridDims.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/Fault.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/FaultCollection.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/FaultFace.hpp>
 
 BOOST_AUTO_TEST_CASE(Empty) {
     Opm::Eclipse3DProperties props;
@@ -44,3 +47,40 @@ BOOST_AUTO_TEST_CASE(Empty) {
     BOOST_CHECK_EQUAL( transMult.getMultiplier(9,9,9, Opm::FaceDir::YMinus) , 1.0 );
     BOOST_CHECK_EQUAL( transMult.getMultiplier(100 , Opm::FaceDir::ZMinus) , 1.0 );
 }
+
+
+BOOST_AUTO_TEST_CASE(FaultCollectionMultipliers) {
+    Opm::Eclipse3DProperties props;
+    Opm::TransMult transMult(Opm::GridDims(5,5,5) ,{} , props);
+    Opm::FaultCollection faults;
+
+    faults.addFault("F1");
+    faults.addFault("F2");
+    faults.setTransMult("F1", 0.5);
+    faults.setTransMult("F2", 0.25);
+    faults.getFault("F1").addFace( Opm::FaultFace(5,5,5, 1,1, 0,4, 0,2, Opm::FaceDir::XPlus) );
+    faults.getFault("F1").addFace( Opm::FaultFace(5,5,5, 2,2, 0,4, 2,4, Opm::FaceDir::XMinus) );
+    faults.getFault("F2").addFace( Opm::FaultFace(5,5,5, 1,1, 2,3, 1,4, Opm::FaceDir::XPlus) );
+    faults.getFault("F2").addFace( Opm::FaultFace(5,5,5, 0,4, 0,4, 3,3, Opm::FaceDir::ZPlus) );
+    transMult.applyMULTFLT( faults );
+
+    for (size_t k = 0; k < 5; k++) {
+        for (size_t j = 0; j < 5; j++) {
+            for (size_t i = 0; i < 5; i++) {
+                double xplus = 1.0;
+                if (i == 1 && k <= 2)
+                    xplus *= 0.5;
+                if (i == 1 && j >= 2 && j <= 3 && k >= 1)
+                    xplus *= 0.25;
+
+                double xminus = (i == 2 && k >= 2) ? 0.5 : 1.0;
+                double zplus = (k == 3) ? 0.25 : 1.0;
+
+                BOOST_CHECK_EQUAL( transMult.getMultiplier(i,j,k, Opm::FaceDir::XPlus) , xplus );
+                BOOST_CHECK_EQUAL( transMult.getMultiplier(i,j,k, Opm::FaceDir::XMinus) , xminus );
+                BOOST_CHECK_EQUAL( transMult.getMultiplier(i,j,k, Opm::FaceDir::ZPlus) , zplus );
+                BOOST_CHECK_EQUAL( transMult.getMultiplier(i,j,k, Opm::FaceDir::YPlus) , 1.0 );
+            }
+        }
+    }
+}
@@ -0,0 +1,259 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE EclOutput
+
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ert/util/ert_unique_ptr.hpp>
+#include <ert/util/TestArea.hpp>
+#include <ert/ecl/ecl_file.h>
+#include <ert/ecl/ecl_kw.h>
+#include <ert/ecl/ecl_type.h>
+
+#include <opm/parser/eclipse/Units/UnitSystem.hpp>
+#include <opm/output/eclipse/EclOutput.hpp>
+
+using namespace Opm;
+
+namespace {
+
+    using ecl_file_ptr = ERT::ert_unique_ptr< ecl_file_type, ecl_file_close >;
+
+    ecl_kw_type* keyword( const ecl_file_ptr& file, const std::string& name ) {
+        BOOST_REQUIRE( ecl_file_has_kw( file.get(), name.c_str() ) );
+        return ecl_file_iget_named_kw( file.get(), name.c_str(), 0 );
+    }
+
+    std::string trim( const std::string& value ) {
+        return value.substr( 0, value.find_last_not_of( ' ' ) + 1 );
+    }
+
+    std::string file_content( const std::string& filename ) {
+        std::ifstream stream( filename, std::ios::binary );
+        return { std::istreambuf_iterator< char >( stream ), std::istreambuf_iterator< char >() };
+    }
+
+}
+
+
+BOOST_AUTO_TEST_CASE(KeywordTypes) {
+    ERT::TestArea ta("test_ecl_output");
+
+    std::vector< int > ints( 2500 );
+    std::vector< float > floats( 1001 );
+    std::vector< double > doubles = { 1.0, -2.5, 1.0e300 };
+    std::vector< std::string > strings( 200 );
+
+    for( size_t i = 0; i < ints.size(); ++i )
+        ints[ i ] = int( i ) - 1000;
+
+    for( size_t i = 0; i < floats.size(); ++i )
+        floats[ i ] = 0.25 * i;
+
+    for( size_t i = 0; i < strings.size(); ++i )
+        strings[ i ] = "W" + std::to_string( i );
+    strings[ 1 ] = "";
+
+    {
+        out::EclOutput output( "TEST.X0000" );
+        output.write( "INTS", ints );
+        output.message( "STARTSOL" );
+        output.write( "FLOATS", floats );
+        output.message( "ENDSOL" );
+        output.write( "DOUBLES", doubles );
+        output.write( "STRINGS", strings );
+        output.write( "EMPTY", std::vector< int >{} );
+        output.close();
+    }
+
+    ecl_file_ptr file( ecl_file_open( "TEST.X0000", 0 ) );
+    BOOST_REQUIRE( file );
+    BOOST_CHECK_EQUAL( ecl_file_get_size( file.get() ), 7 );
+
+    const std::vector< std::string > names = { "INTS", "STARTSOL", "FLOATS", "ENDSOL",
+                                               "DOUBLES", "STRINGS", "EMPTY" };
+    for( size_t i = 0; i < names.size(); ++i )
+        BOOST_CHECK_EQUAL( ecl_kw_get_header( ecl_file_iget_kw( file.get(), i ) ), names[ i ] );
+
+    const auto* ints_kw = keyword( file, "INTS" );
+    BOOST_CHECK_EQUAL( ecl_type_get_type( ecl_kw_get_data_type( ints_kw ) ), ECL_INT_TYPE );
+    BOOST_REQUIRE_EQUAL( ecl_kw_get_size( ints_kw ), int( ints.size() ) );
+    for( size_t i = 0; i < ints.size(); ++i )
+        BOOST_CHECK_EQUAL( ecl_kw_iget_int( ints_kw, i ), ints[ i ] );
+
+    const auto* floats_kw = keyword( file, "FLOATS" );
+    BOOST_CHECK_EQUAL( ecl_type_get_type( ecl_kw_get_data_type( floats_kw ) ), ECL_FLOAT_TYPE );
+    BOOST_REQUIRE_EQUAL( ecl_kw_get_size( floats_kw ), int( floats.size() ) );
+    for( size_t i = 0; i < floats.size(); ++i )
+        BOOST_CHECK_EQUAL( ecl_kw_iget_float( floats_kw, i ), floats[ i ] );
+
+    const auto* doubles_kw = keyword( file, "DOUBLES" );
+    BOOST_CHECK_EQUAL( ecl_type_get_type( ecl_kw_get_data_type( doubles_kw ) ), ECL_DOUBLE_TYPE );
+    BOOST_REQUIRE_EQUAL( ecl_kw_get_size( doubles_kw ), int( doubles.size() ) );
+    for( size_t i = 0; i < doubles.size(); ++i )
+        BOOST_CHECK_EQUAL( ecl_kw_iget_double( doubles_kw, i ), doubles[ i ] );
+
+    const auto* strings_kw = keyword( file, "STRINGS" );
+    BOOST_CHECK_EQUAL( ecl_type_get_type( ecl_kw_get_data_type( strings_kw ) ), ECL_CHAR_TYPE );
+    BOOST_REQUIRE_EQUAL( ecl_kw_get_size( strings_kw ), int( strings.size() ) );
+    for( size_t i = 0; i < strings.size(); ++i )
+        BOOST_CHECK_EQUAL( trim( ecl_kw_iget_char_ptr( strings_kw, i ) ), strings[ i ] );
+
+    BOOST_CHECK_EQUAL( ecl_kw_get_size( keyword( file, "EMPTY" ) ), 0 );
+}
+
+
+BOOST_AUTO_TEST_CASE(FloatAndUnitConversion) {
+    ERT::TestArea ta("test_ecl_output");
+
+    const auto units = UnitSystem::newFIELD();
+    std::vector< double > pressure( 5000 );
+    for( size_t i = 0; i < pressure.size(); ++i )
+        pressure[ i ] = 1.0e5 + 10.0 * i;
+
+    auto expected = pressure;
+    units.from_si( UnitSystem::measure::pressure, expected );
+
+    {
+        out::EclOutput output( "TEST.X0000" );
+        output.writeFloat( "NARROW", pressure );
+        output.writeFromSI( "PRESSURE", pressure, units, UnitSystem::measure::pressure, false );
+        output.writeFromSI( "PRESDBL", pressure, units, UnitSystem::measure::pressure, true );
+        output.close();
+    }
+
+    ecl_file_ptr file( ecl_file_open( "TEST.X0000", 0 ) );
+    BOOST_REQUIRE( file );
+
+    const auto* narrow = keyword( file, "NARROW" );
+    const auto* pressure_kw = keyword( file, "PRESSURE" );
+    const auto* presdbl = keyword( file, "PRESDBL" );
+    BOOST_CHECK_EQUAL( ecl_type_get_type( ecl_kw_get_data_type( pressure_kw ) ), ECL_FLOAT_TYPE );
+    BOOST_CHECK_EQUAL( ecl_type_get_type( ecl_kw_get_data_type( presdbl ) ), ECL_DOUBLE_TYPE );
+
+    for( size_t i = 0; i < pressure.size(); ++i ) {
+        BOOST_CHECK_EQUAL( ecl_kw_iget_float( narrow, i ), float( pressure[ i ] ) );
+        BOOST_CHECK_EQUAL( ecl_kw_iget_float( pressure_kw, i ), float( expected[ i ] ) );
+        BOOST_CHECK_EQUAL( ecl_kw_iget_double( presdbl, i ), expected[ i ] );
+    }
+
+    /* The input is not modified. */
+    BOOST_CHECK_EQUAL( pressure[ 1 ], 1.0e5 + 10.0 );
+}
+
+
+BOOST_AUTO_TEST_CASE(AppendAndLargeOutput) {
+    ERT::TestArea ta("test_ecl_output");
+
+    /* Much larger than the output buffer. */
+    std::vector< int > data( 100000 );
+    for( size_t i = 0; i < data.size(); ++i )
+        data[ i ] = i;
+
+    {
+        out::EclOutput output( "TEST.X0000", false, 1024 );
+        output.write( "FIRST", data );
+    }
+
+    {
+        out::EclOutput output( "TEST.X0000", true );
+        output.write( "SECOND", std::vector< int >{ 42 } );
+        output.close();
+    }
+
+    ecl_file_ptr file( ecl_file_open( "TEST.X0000", 0 ) );
+    BOOST_REQUIRE( file );
+    BOOST_CHECK_EQUAL( ecl_file_get_size( file.get() ), 2 );
+
+    const auto* first = keyword( file, "FIRST" );
+    BOOST_REQUIRE_EQUAL( ecl_kw_get_size( first ), int( data.size() ) );
+    BOOST_CHECK_EQUAL( ecl_kw_iget_int( first, 99999 ), 99999 );
+    BOOST_CHECK_EQUAL( ecl_kw_iget_int( keyword( file, "SECOND" ), 0 ), 42 );
+
+    out::EclOutput output( "TEST.X0000" );
+    BOOST_CHECK_THROW( output.write( "TOOLONGNAME", data ), std::invalid_argument );
+    BOOST_CHECK_THROW( out::EclOutput( "NO_SUCH_DIR/TEST.X0000" ), std::runtime_error );
+}
+
+
+BOOST_AUTO_TEST_CASE(PositionedOutput) {
+    ERT::TestArea ta("test_ecl_output");
+
+    std::vector< double > pressure( 2503 );
+    std::vector< double > swat( 1100003 );
+    for( size_t i = 0; i < pressure.size(); ++i )
+        pressure[ i ] = 100.0 + 0.5 * i;
+
+    for( size_t i = 0; i < swat.size(); ++i )
+        swat[ i ] = 1.0 / ( i + 1 );
+
+    {
+        out::EclOutput output( "SERIAL.X0000" );
+        output.message( "STARTSOL" );
+        output.writeFloat( "PRESSURE", pressure );
+        output.write( "SWAT", swat );
+        output.close();
+    }
+
+    const auto pressure_offset = out::EclPositionedOutput::keywordSize( 0, false );
+    const auto swat_offset = pressure_offset + out::EclPositionedOutput::keywordSize( pressure.size(), false );
+    const auto size = swat_offset + out::EclPositionedOutput::keywordSize( swat.size(), true );
+    {
+        out::EclPositionedOutput output( "PARALLEL.X0000" );
+        output.resize( size );
+        output.message( 0, "STARTSOL" );
+        output.writeHeader( pressure_offset, "PRESSURE", pressure.size(), false );
+        output.writeHeader( swat_offset, "SWAT", swat.size(), true );
+        BOOST_CHECK_THROW( output.writeRange( pressure_offset, pressure.size(), 2500, pressure.data(), 4, false ),
+                           std::out_of_range );
+    }
+
+    /*
+      Three writers own runs of 7 cells in turn, and one writer writes
+      SWAT, which is larger than what is written with one pwrite().
+    */
+    std::vector< std::thread > writers;
+    for( size_t rank = 0; rank < 3; ++rank )
+        writers.emplace_back( [&, rank]() {
+            out::EclPositionedOutput output( "PARALLEL.X0000" );
+            for( size_t first = 7 * rank; first < pressure.size(); first += 21 ) {
+                const auto n = std::min< size_t >( 7, pressure.size() - first );
+                output.writeRange( pressure_offset, pressure.size(), first, pressure.data() + first, n, false );
+            }
+        });
+
+    writers.emplace_back( [&]() {
+        out::EclPositionedOutput output( "PARALLEL.X0000" );
+        output.writeRange( swat_offset, swat.size(), 0, swat.data(), swat.size(), true );
+    });
+
+    for( auto& writer : writers )
+        writer.join();
+
+    const auto serial = file_content( "SERIAL.X0000" );
+    BOOST_CHECK_EQUAL( serial.size(), size );
+    BOOST_CHECK( serial == file_content( "PARALLEL.X0000" ) );
+}
@@ -397,5 +397,81 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
     BOOST_CHECK_EQUAL( file_size, write_and_check( 3, 5 ) );
 }
 
+BOOST_AUTO_TEST_CASE(EclipseIOAsyncOutput) {
+    const char *deckString =
+        "RUNSPEC\n"
+        "UNIFOUT\n"
+        "OIL\n"
+        "GAS\n"
+        "WATER\n"
+        "METRIC\n"
+        "DIMENS\n"
+        "3 3 3/\n"
+        "GRID\n"
+        "DXV\n"
+        "1.0 2.0 3.0 /\n"
+        "DYV\n"
+        "4.0 5.0 6.0 /\n"
+        "DZV\n"
+        "7.0 8.0 9.0 /\n"
+        "TOPS\n"
+        "9*100 /\n"
+        "PROPS\n"
+        "PORO\n"
+        "27*0.3 /\n"
+        "PERMX\n"
+        "27*1 /\n"
+        "SOLUTION\n"
+        "RPTRST\n"
+        "BASIC=2\n"
+        "/\n"
+        "SCHEDULE\n"
+        "TSTEP\n"
+        "1.0 2.0 3.0 4.0 5.0 6.0 7.0 /\n";
+
+    ERT::TestArea ta("test_ecl_writer_async");
+
+    ParseContext parse_context;
+    auto deck = Parser().parseString( deckString, parse_context );
+    auto es = Parser::parse( deck );
+    auto& eclGrid = es.getInputGrid();
+    Schedule schedule(deck, eclGrid, es.get3DProperties(), es.runspec().phases(), parse_context);
+    SummaryConfig summary_config( deck, schedule, es.getTableManager( ), parse_context);
+    es.getIOConfig().setBaseName( "FOO" );
+
+    EclipseIO eclWriter( es, eclGrid , schedule, summary_config);
+    eclWriter.enableAsyncOutput( 2 );
+    eclWriter.writeInitial( );
+
+    using measure = UnitSystem::measure;
+    using TargetType = data::TargetType;
+    data::Wells wells;
+    for( int i = 1; i < 5; ++i ) {
+        data::Solution sol = createBlackoilState( i, 3 * 3 * 3 );
+        sol.insert("KRO", measure::identity , std::vector<double>(3*3*3 , i), TargetType::RESTART_AUXILIARY);
+        sol.insert("KRG", measure::identity , std::vector<double>(3*3*3 , i*10), TargetType::RESTART_AUXILIARY);
+
+        eclWriter.writeTimeStep( i, false, i * 86400.0, RestartValue(sol, wells), {}, {}, {});
+    }
+
+    /* All the queued steps are in the restart file after flush(). */
+    eclWriter.flush();
+    checkRestartFile( 4 );
+
+    /*
+      The invalid solution fails on the output thread; the error is
+      rethrown from flush(), and the writer can be used again afterwards.
+    */
+    data::Solution invalid;
+    invalid.insert( "PRESSURE", measure::pressure, std::vector<double>( 10 ), TargetType::RESTART_SOLUTION );
+    eclWriter.writeTimeStep( 5, false, 5 * 86400.0, RestartValue(invalid, wells), {}, {}, {});
+    BOOST_CHECK_THROW( eclWriter.flush(), std::runtime_error );
+    BOOST_CHECK_NO_THROW( eclWriter.flush() );
+
+    eclWriter.writeTimeStep( 5, false, 5 * 86400.0, RestartValue(createBlackoilState( 5, 3 * 3 * 3 ), wells), {}, {}, {});
+    eclWriter.flush();
+    checkRestartFile( 5 );
+}
+
 BOOST_AUTO_TEST_CASE(OPM_XWEL) {
 }
@@ -18,6 +18,9 @@
 #include "config.h"
 
 #include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <thread>
 
 #define BOOST_TEST_MODULE EclipseIO
 #include <boost/test/unit_test.hpp>
@@ -574,6 +577,64 @@ BOOST_AUTO_TEST_CASE(ExtraData_content) {
 }
 
 
+BOOST_AUTO_TEST_CASE(DistributedSave) {
+    Setup setup("FIRST_SIM.DATA");
+    {
+        ERT::TestArea testArea("test_Restart");
+        const size_t num_cells = setup.grid.getNumActive( );
+        const auto cells = mkSolution( num_cells );
+        const auto wells = mkWells();
+        const size_t num_ranks = 3;
+
+        RestartValue restart_value(cells, wells);
+        restart_value.addExtra("EXTRA", UnitSystem::measure::pressure, {10,1,2,3});
+        RestartIO::save("SERIAL.UNRST", 1, 100, restart_value, setup.es, setup.grid, setup.schedule);
+
+        /* The ranks own runs of 7 cells in turn. */
+        std::vector< data::Solution > local_solution( num_ranks );
+        std::vector< std::vector< int > > global_index( num_ranks );
+        for (size_t cell = 0; cell < num_cells; ++cell)
+            global_index[ (cell / 7) % num_ranks ].push_back( cell );
+
+        for (size_t rank = 0; rank < num_ranks; ++rank) {
+            for (const auto& elm : cells) {
+                std::vector< double > data;
+                for (const auto cell : global_index[rank])
+                    data.push_back( elm.second.data[cell] );
+
+                local_solution[rank].insert( elm.first, elm.second.dim, data, elm.second.target );
+            }
+        }
+
+        RestartValue root_value(local_solution[0], wells);
+        root_value.addExtra("EXTRA", UnitSystem::measure::pressure, {10,1,2,3});
+        const auto offset = RestartIO::saveLayout("PARALLEL.UNRST", 1, 100, root_value, setup.es, setup.grid, setup.schedule);
+
+        std::vector< std::thread > ranks;
+        for (size_t rank = 0; rank < num_ranks; ++rank)
+            ranks.emplace_back( [&, rank]() {
+                RestartIO::saveSolutionSlice("PARALLEL.UNRST", offset, local_solution[rank],
+                                             global_index[rank], setup.es.getUnits(), num_cells);
+            });
+
+        for (auto& rank : ranks)
+            rank.join();
+
+        const auto content = []( const std::string& filename ) {
+            std::ifstream stream( filename, std::ios::binary );
+            return std::string( std::istreambuf_iterator< char >( stream ), std::istreambuf_iterator< char >() );
+        };
+        BOOST_CHECK( content( "SERIAL.UNRST" ) == content( "PARALLEL.UNRST" ) );
+
+        std::vector< int > duplicated = global_index[1];
+        duplicated.push_back( duplicated.front() );
+        BOOST_CHECK_THROW( RestartIO::saveSolutionSlice("PARALLEL.UNRST", offset, local_solution[1],
+                                                        duplicated, setup.es.getUnits(), num_cells),
+                           std::invalid_argument );
+    }
+}
+
+
 BOOST_AUTO_TEST_CASE(STORE_THPRES) {
     Setup setup("FIRST_SIM_THPRES.DATA");
     {
@@ -0,0 +1,188 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE RestartFile
+
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <ert/util/TestArea.hpp>
+
+#include <opm/parser/eclipse/Units/UnitSystem.hpp>
+#include <opm/output/eclipse/EclOutput.hpp>
+#include <opm/output/eclipse/RestartFile.hpp>
+
+using namespace Opm;
+
+namespace {
+
+    std::vector< double > pressure( size_t size, int report_step ) {
+        std::vector< double > data( size );
+        for( size_t i = 0; i < size; ++i )
+            data[ i ] = 100.0 + report_step + 0.25 * i;
+
+        return data;
+    }
+
+    void write_step( out::EclOutput& output, int report_step, size_t num_cells ) {
+        output.write( "SEQNUM", std::vector< int >{ report_step } );
+        output.write( "INTEHEAD", std::vector< int >{ 1, 2, report_step } );
+        output.write( "ZWEL", std::vector< std::string >{ "PROD", "INJ" } );
+        output.message( "STARTSOL" );
+        output.writeFloat( "PRESSURE", pressure( num_cells, report_step ) );
+        output.write( "SWAT", std::vector< double >( num_cells, 0.5 + report_step ) );
+        output.message( "ENDSOL" );
+    }
+
+    bool exists( const std::string& filename ) {
+        return bool( std::ifstream( filename ) );
+    }
+
+}
+
+
+BOOST_AUTO_TEST_CASE(UnifiedReportSteps) {
+    ERT::TestArea ta("test_restart_file");
+    {
+        out::EclOutput output( "CASE.UNRST" );
+        write_step( output, 1, 2500 );
+        write_step( output, 5, 2500 );
+        output.close();
+    }
+
+    const RestartIO::RestartFile rst_file( "CASE.UNRST" );
+    const std::vector< int > steps = { 1, 5 };
+    const auto found = rst_file.reportSteps();
+    BOOST_CHECK_EQUAL_COLLECTIONS( found.begin(), found.end(), steps.begin(), steps.end() );
+
+    BOOST_CHECK( rst_file.hasReportStep( 5 ) );
+    BOOST_CHECK( !rst_file.hasReportStep( 2 ) );
+    BOOST_CHECK( rst_file.hasKeyword( 5, "ENDSOL" ) );
+    BOOST_CHECK( !rst_file.hasKeyword( 5, "SGAS" ) );
+    BOOST_CHECK( !rst_file.hasKeyword( 2, "SWAT" ) );
+
+    BOOST_CHECK_EQUAL( rst_file.keyword( 1, "PRESSURE" ).type, "REAL" );
+    BOOST_CHECK_EQUAL( rst_file.keyword( 1, "PRESSURE" ).size, 2500U );
+    BOOST_CHECK_EQUAL( rst_file.getInt( 5, "INTEHEAD" )[ 2 ], 5 );
+
+    const auto swat = rst_file.getDouble( 5, "SWAT" );
+    BOOST_CHECK_EQUAL( swat.size(), 2500U );
+    BOOST_CHECK_EQUAL( swat[ 2499 ], 5.5 );
+
+    const auto units = UnitSystem::newMETRIC();
+    const auto expected = pressure( 2500, 5 );
+    std::vector< double > data;
+    rst_file.readSI( 5, "PRESSURE", units, UnitSystem::measure::pressure, data );
+    BOOST_REQUIRE_EQUAL( data.size(), expected.size() );
+    for( size_t i = 0; i < data.size(); ++i )
+        BOOST_CHECK_EQUAL( data[ i ], units.to_si( UnitSystem::measure::pressure, float( expected[ i ] ) ) );
+
+    BOOST_CHECK_THROW( rst_file.getInt( 2, "INTEHEAD" ), std::invalid_argument );
+    BOOST_CHECK_THROW( rst_file.getInt( 1, "PRESSURE" ), std::invalid_argument );
+    BOOST_CHECK_THROW( rst_file.getDouble( 1, "ZWEL" ), std::invalid_argument );
+    BOOST_CHECK_THROW( RestartIO::RestartFile( "NOSUCH.UNRST" ), std::runtime_error );
+}
+
+
+BOOST_AUTO_TEST_CASE(NonUnified) {
+    ERT::TestArea ta("test_restart_file");
+    {
+        out::EclOutput output( "CASE.X0003" );
+        output.write( "INTEHEAD", std::vector< int >{ 1, 2, 3 } );
+        output.writeFloat( "PRESSURE", pressure( 10, 3 ) );
+        output.close();
+    }
+
+    const RestartIO::RestartFile rst_file( "CASE.X0003" );
+    BOOST_CHECK_EQUAL( rst_file.reportSteps().size(), 1U );
+    BOOST_CHECK( rst_file.hasReportStep( 99 ) );
+    BOOST_CHECK_EQUAL( rst_file.getDouble( 99, "PRESSURE" )[ 4 ], 104.0 );
+}
+
+
+BOOST_AUTO_TEST_CASE(IndexFile) {
+    ERT::TestArea ta("test_restart_file");
+    {
+        out::EclOutput output( "CASE.UNRST" );
+        write_step( output, 1, 10 );
+        output.close();
+    }
+
+    const auto index_file = RestartIO::RestartFile::indexFilename( "CASE.UNRST" );
+    BOOST_CHECK_EQUAL( RestartIO::RestartFile( "CASE.UNRST", true ).reportSteps().size(), 1U );
+    BOOST_CHECK( exists( index_file ) );
+    BOOST_CHECK_EQUAL( RestartIO::RestartFile( "CASE.UNRST", true ).getInt( 1, "INTEHEAD" )[ 2 ], 1 );
+
+    /* The index of a modified file is rebuilt. */
+    {
+        out::EclOutput output( "CASE.UNRST", true );
+        write_step( output, 2, 10 );
+        output.close();
+    }
+
+    const RestartIO::RestartFile rst_file( "CASE.UNRST", true );
+    BOOST_CHECK_EQUAL( rst_file.reportSteps().size(), 2U );
+    BOOST_CHECK_EQUAL( rst_file.getDouble( 2, "PRESSURE" )[ 9 ], 102.0 + 2.25 );
+
+    /* A corrupt index is ignored. */
+    std::ofstream( index_file, std::ios::trunc ) << "garbage";
+    BOOST_CHECK_EQUAL( RestartIO::RestartFile( "CASE.UNRST", true ).reportSteps().size(), 2U );
+}
+
+
+BOOST_AUTO_TEST_CASE(ParallelRead) {
+    ERT::TestArea ta("test_restart_file");
+    const size_t num_cells = 1000 * 1000 + 17;
+    {
+        out::EclOutput output( "CASE.UNRST" );
+        write_step( output, 1, num_cells );
+        output.close();
+    }
+
+    const auto units = UnitSystem::newFIELD();
+    std::vector< double > serial, parallel;
+    RestartIO::RestartFile( "CASE.UNRST", false, 1 ).readSI( 1, "PRESSURE", units, UnitSystem::measure::pressure, serial );
+    RestartIO::RestartFile( "CASE.UNRST", false, 4 ).readSI( 1, "PRESSURE", units, UnitSystem::measure::pressure, parallel );
+
+    BOOST_REQUIRE_EQUAL( parallel.size(), num_cells );
+    BOOST_CHECK( serial == parallel );
+    BOOST_CHECK_EQUAL( parallel.back(), units.to_si( UnitSystem::measure::pressure, float( 101.0 + 0.25 * ( num_cells - 1 ) ) ) );
+}
+
+
+BOOST_AUTO_TEST_CASE(TruncatedFile) {
+    ERT::TestArea ta("test_restart_file");
+    {
+        out::EclOutput output( "CASE.UNRST" );
+        write_step( output, 1, 10 );
+        output.write( "SGAS", std::vector< double >( 5000 ) );
+        output.close();
+    }
+
+    {
+        std::ifstream input( "CASE.UNRST", std::ios::binary );
+        std::string data{ std::istreambuf_iterator< char >( input ), std::istreambuf_iterator< char >() };
+        std::ofstream( "CASE.UNRST", std::ios::binary | std::ios::trunc ) << data.substr( 0, data.size() - 100 );
+    }
+
+    BOOST_CHECK_THROW( RestartIO::RestartFile( "CASE.UNRST" ), std::runtime_error );
+}
@@ -1249,6 +1249,27 @@ BOOST_AUTO_TEST_CASE(Test_SummaryState) {
     BOOST_CHECK_THROW(st.get("NO_SUCH_KEY"), std::invalid_argument);
     BOOST_CHECK(st.has("WWCT:OP_2"));
     BOOST_CHECK(!st.has("NO_SUCH_KEY"));
+
+    const auto id = st.add_key("FOPT");
+    BOOST_CHECK_EQUAL(st.add_key("FOPT"), id);
+    BOOST_CHECK_EQUAL(st.key_id("FOPT"), id);
+    BOOST_CHECK_EQUAL(st.key(id), "FOPT");
+    BOOST_CHECK_EQUAL(st.key_id("WWCT:OP_2"), 0U);
+    BOOST_CHECK_THROW(st.key_id("NO_SUCH_KEY"), std::invalid_argument);
+
+    BOOST_CHECK(!st.has(id));
+    BOOST_CHECK(!st.has("FOPT"));
+    BOOST_CHECK_THROW(st.get(id), std::invalid_argument);
+
+    st.set(id, 25);
+    BOOST_CHECK_EQUAL(st.get("FOPT"), 25);
+    BOOST_CHECK_EQUAL(std::distance(st.begin(), st.end()), 2);
+
+    st.reset();
+    BOOST_CHECK(!st.has(id));
+    BOOST_CHECK(st.begin() == st.end());
+    BOOST_CHECK_EQUAL(st.size(), 2U);
+    BOOST_CHECK_EQUAL(st.key_id("FOPT"), id);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
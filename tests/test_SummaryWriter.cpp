@@ -0,0 +1,258 @@
+/*
+  Copyright 2018 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE SummaryWriter
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <ert/util/TestArea.hpp>
+
+#include <opm/output/eclipse/SummaryWriter.hpp>
+
+using namespace Opm;
+
+namespace {
+
+    /* A minimal reader for unformatted eclipse files. */
+    struct Keyword {
+        std::string name;
+        std::string type;
+        std::vector< int > ints;
+        std::vector< float > floats;
+        std::vector< std::string > strings;
+    };
+
+    std::uint32_t get_uint32( const std::vector< char >& data, size_t pos ) {
+        const auto* bytes = reinterpret_cast< const unsigned char* >( data.data() + pos );
+        return ( std::uint32_t( bytes[ 0 ] ) << 24 ) | ( std::uint32_t( bytes[ 1 ] ) << 16 )
+             | ( std::uint32_t( bytes[ 2 ] ) << 8 ) | std::uint32_t( bytes[ 3 ] );
+    }
+
+    std::vector< std::vector< char > > read_records( const std::string& filename ) {
+        std::ifstream stream( filename, std::ios::binary );
+        BOOST_REQUIRE( stream );
+
+        const std::vector< char > data{ std::istreambuf_iterator< char >( stream ),
+                                        std::istreambuf_iterator< char >() };
+        std::vector< std::vector< char > > records;
+
+        size_t pos = 0;
+        while( pos < data.size() ) {
+            const auto size = get_uint32( data, pos );
+            BOOST_REQUIRE( pos + 8 + size <= data.size() );
+            BOOST_REQUIRE_EQUAL( size, get_uint32( data, pos + 4 + size ) );
+
+            records.emplace_back( data.begin() + pos + 4, data.begin() + pos + 4 + size );
+            pos += 8 + size;
+        }
+
+        return records;
+    }
+
+    std::vector< Keyword > read_keywords( const std::string& filename ) {
+        const auto records = read_records( filename );
+        std::vector< Keyword > keywords;
+
+        size_t index = 0;
+        while( index < records.size() ) {
+            const auto& header = records[ index++ ];
+            BOOST_REQUIRE_EQUAL( header.size(), 16U );
+
+            Keyword kw;
+            kw.name = std::string( header.begin(), header.begin() + 8 );
+            kw.name.erase( kw.name.find_last_not_of( ' ' ) + 1 );
+            kw.type = std::string( header.begin() + 12, header.end() );
+            const size_t count = get_uint32( header, 8 );
+
+            size_t read = 0;
+            while( read < count ) {
+                const auto& record = records.at( index++ );
+                const size_t block_size = kw.type == "CHAR" ? 105 : 1000;
+                const size_t element_size = kw.type == "CHAR" ? 8 : 4;
+                const size_t elements = record.size() / element_size;
+
+                BOOST_CHECK( elements == block_size || read + elements == count );
+
+                for( size_t i = 0; i < elements; ++i ) {
+                    if( kw.type == "CHAR" ) {
+                        std::string value( record.begin() + 8 * i, record.begin() + 8 * i + 8 );
+                        kw.strings.push_back( value.erase( value.find_last_not_of( ' ' ) + 1 ) );
+                    } else if( kw.type == "INTE" )
+                        kw.ints.push_back( static_cast< std::int32_t >( get_uint32( record, 4 * i ) ) );
+                    else {
+                        const auto bits = get_uint32( record, 4 * i );
+                        float value;
+                        std::memcpy( &value, &bits, sizeof( value ) );
+                        kw.floats.push_back( value );
+                    }
+                }
+                read += elements;
+            }
+
+            keywords.push_back( kw );
+        }
+
+        return keywords;
+    }
+
+    const Keyword& find( const std::vector< Keyword >& keywords, const std::string& name ) {
+        for( const auto& kw : keywords )
+            if( kw.name == name )
+                return kw;
+
+        throw std::invalid_argument( "No such keyword: " + name );
+    }
+
+    std::vector< std::string > names( const std::vector< Keyword >& keywords ) {
+        std::vector< std::string > result;
+        for( const auto& kw : keywords )
+            result.push_back( kw.name );
+
+        return result;
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(Specification) {
+    ERT::TestArea ta("test_summary_writer");
+
+    out::SummaryWriter writer( "CASE", true, 24 * 3600, 10, 20, 30, 2, "BASE", 7 );
+    BOOST_CHECK_EQUAL( writer.addVector( "WOPR", "PROD", 0, "STB/DAY" ), 1U );
+    BOOST_CHECK_EQUAL( writer.addVector( "FOPT", "", 0, "STB" ), 2U );
+    BOOST_CHECK_EQUAL( writer.addVector( "BPR", "", 123, "PSIA" ), 3U );
+    writer.write();
+
+    const auto spec = read_keywords( "CASE.SMSPEC" );
+    BOOST_CHECK_EQUAL( find( spec, "INTEHEAD" ).ints[ 0 ], 2 );
+    BOOST_CHECK_EQUAL( find( spec, "RESTART" ).strings[ 0 ], "BASE" );
+
+    const std::vector< int > dimens = { 4, 10, 20, 30, 0, 7 };
+    const auto& dims = find( spec, "DIMENS" ).ints;
+    BOOST_CHECK_EQUAL_COLLECTIONS( dims.begin(), dims.end(), dimens.begin(), dimens.end() );
+
+    const std::vector< std::string > keywords = { "TIME", "WOPR", "FOPT", "BPR" };
+    const auto& kw = find( spec, "KEYWORDS" ).strings;
+    BOOST_CHECK_EQUAL_COLLECTIONS( kw.begin(), kw.end(), keywords.begin(), keywords.end() );
+
+    BOOST_CHECK_EQUAL( find( spec, "WGNAMES" ).strings[ 1 ], "PROD" );
+    BOOST_CHECK_EQUAL( find( spec, "WGNAMES" ).strings[ 2 ], ":+:+:+:+" );
+    BOOST_CHECK_EQUAL( find( spec, "NUMS" ).ints[ 3 ], 123 );
+    BOOST_CHECK_EQUAL( find( spec, "UNITS" ).strings[ 0 ], "DAYS" );
+
+    const std::vector< int > startdat = { 2, 1, 1970, 0, 0, 0 };
+    const auto& start = find( spec, "STARTDAT" ).ints;
+    BOOST_CHECK_EQUAL_COLLECTIONS( start.begin(), start.end(), startdat.begin(), startdat.end() );
+}
+
+
+BOOST_AUTO_TEST_CASE(UnifiedAppend) {
+    ERT::TestArea ta("test_summary_writer");
+
+    out::SummaryWriter writer( "CASE", true, 0, 1, 1, 1, 1 );
+    const auto wopr = writer.addVector( "WOPR", "PROD", 0, "SM3/DAY" );
+
+    writer.addTimestep( 1, 0.5 );
+    writer.set( wopr, 10.0 );
+    writer.write();
+    const auto first = read_keywords( "CASE.UNSMRY" );
+
+    writer.addTimestep( 1, 1.0 );
+    writer.set( wopr, 20.0 );
+    writer.addTimestep( 2, 2.0 );
+    writer.write();
+
+    const auto data = read_keywords( "CASE.UNSMRY" );
+    const std::vector< std::string > expected = { "SEQHDR", "MINISTEP", "PARAMS",
+                                                  "MINISTEP", "PARAMS",
+                                                  "SEQHDR", "MINISTEP", "PARAMS" };
+    const auto found = names( data );
+    BOOST_CHECK_EQUAL_COLLECTIONS( found.begin(), found.end(), expected.begin(), expected.end() );
+
+    /* The first write is kept, the later ministeps are appended. */
+    BOOST_CHECK_EQUAL( first.size(), 3U );
+    BOOST_CHECK_EQUAL( data[ 2 ].floats[ 1 ], 10.0 );
+
+    BOOST_CHECK_EQUAL( data[ 1 ].ints[ 0 ], 0 );
+    BOOST_CHECK_EQUAL( data[ 3 ].ints[ 0 ], 1 );
+    BOOST_CHECK_EQUAL( data[ 6 ].ints[ 0 ], 2 );
+
+    BOOST_CHECK_EQUAL( data[ 4 ].floats[ 0 ], 1.0 );
+    BOOST_CHECK_EQUAL( data[ 4 ].floats[ 1 ], 20.0 );
+    BOOST_CHECK_EQUAL( data[ 7 ].floats[ 0 ], 2.0 );
+    BOOST_CHECK_EQUAL( data[ 7 ].floats[ 1 ], 0.0 );
+}
+
+
+BOOST_AUTO_TEST_CASE(NonUnifiedFiles) {
+    ERT::TestArea ta("test_summary_writer");
+
+    out::SummaryWriter writer( "CASE", false, 0, 1, 1, 1, 1 );
+    const auto wopr = writer.addVector( "WOPR", "PROD", 0, "SM3/DAY" );
+
+    for( int step = 1; step <= 3; ++step ) {
+        writer.addTimestep( step, step );
+        writer.set( wopr, 10.0 * step );
+        writer.addTimestep( step, step + 0.5 );
+        writer.set( wopr, 10.0 * step + 5 );
+        writer.write();
+    }
+
+    for( int step = 1; step <= 3; ++step ) {
+        const auto data = read_keywords( "CASE.S000" + std::to_string( step ) );
+        const std::vector< std::string > expected = { "SEQHDR", "MINISTEP", "PARAMS", "MINISTEP", "PARAMS" };
+        const auto found = names( data );
+        BOOST_CHECK_EQUAL_COLLECTIONS( found.begin(), found.end(), expected.begin(), expected.end() );
+
+        BOOST_CHECK_EQUAL( data[ 1 ].ints[ 0 ], 2 * ( step - 1 ) );
+        BOOST_CHECK_EQUAL( data[ 2 ].floats[ 1 ], 10.0 * step );
+        BOOST_CHECK_EQUAL( data[ 4 ].floats[ 1 ], 10.0 * step + 5 );
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(LargeParamsAndNewVectors) {
+    ERT::TestArea ta("test_summary_writer");
+
+    out::SummaryWriter writer( "CASE", true, 0, 1, 1, 1, 1 );
+    for( int i = 0; i < 2500; ++i )
+        writer.addVector( "BPR", "", i + 1, "BARSA" );
+
+    writer.addTimestep( 1, 1.0 );
+    writer.set( 2500, 42.0 );
+    BOOST_CHECK_THROW( writer.set( 2501, 1.0 ), std::out_of_range );
+    writer.write();
+    BOOST_CHECK_THROW( writer.set( 1, 1.0 ), std::logic_error );
+
+    const auto data = read_keywords( "CASE.UNSMRY" );
+    BOOST_CHECK_EQUAL( data[ 2 ].floats.size(), 2501U );
+    BOOST_CHECK_EQUAL( data[ 2 ].floats[ 2500 ], 42.0 );
+
+    /* A new vector rewrites the specification. */
+    writer.addVector( "FOPR", "", 0, "SM3/DAY" );
+    writer.addTimestep( 2, 2.0 );
+    writer.write();
+    BOOST_CHECK_EQUAL( find( read_keywords( "CASE.SMSPEC" ), "DIMENS" ).ints[ 0 ], 2502 );
+}
@@ -65,4 +65,53 @@ BOOST_AUTO_TEST_CASE (cubic)
     BOOST_REQUIRE_CLOSE (interp.evaluate(4.0), 2., 0.00001);
 }
 
+BOOST_AUTO_TEST_CASE (cubic_batch)
+{
+    std::vector<double> x = {0.0, 1.0, 2.0, 3.0, 5.0};
+    std::vector<double> f = {1.0, 2.0, 2.5, 4.0, 8.0};
+    MonotCubicInterpolator interp(x, f);
+    BOOST_CHECK (interp.isStrictlyIncreasing());
+
+    std::vector<double> sorted_x;
+    for (int i = -10; i <= 60; ++i) {
+        sorted_x.push_back(0.1*i);
+    }
+    const std::vector<double> sorted_f = interp.evaluate(sorted_x);
+    BOOST_REQUIRE_EQUAL (sorted_f.size(), sorted_x.size());
+    for (size_t i = 0; i < sorted_x.size(); ++i) {
+        BOOST_CHECK_EQUAL (sorted_f[i], interp.evaluate(sorted_x[i]));
+    }
+
+    const std::vector<double> unsorted_x = {4.5, -1.0, 0.0, 2.5, 1.0, 7.0, 0.3};
+    const std::vector<double> unsorted_f = interp.evaluate(unsorted_x);
+    for (size_t i = 0; i < unsorted_x.size(); ++i) {
+        BOOST_CHECK_EQUAL (unsorted_f[i], interp.evaluate(unsorted_x[i]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE (cubic_addpair)
+{
+    // Unsorted input, the last of duplicate x-values wins.
+    std::vector<double> x = {2.0, 0.0, 1.0, 2.0};
+    std::vector<double> f = {5.0, 1.0, 2.0, 3.0};
+    MonotCubicInterpolator interp(x, f);
+    BOOST_CHECK_EQUAL (interp.getSize(), 3);
+    BOOST_CHECK_EQUAL (interp.getMaximumX().second, 3.0);
+    BOOST_CHECK (interp.isStrictlyIncreasing());
+
+    interp.addPair(1.5, 1.0);
+    BOOST_CHECK_EQUAL (interp.getSize(), 4);
+    BOOST_CHECK (!interp.isMonotone());
+    BOOST_CHECK_EQUAL (interp.evaluate(1.5), 1.0);
+
+    interp.addPair(1.5, 2.5);
+    BOOST_CHECK_EQUAL (interp.getSize(), 4);
+    BOOST_CHECK (interp.isStrictlyIncreasing());
+    BOOST_CHECK_EQUAL (interp.getMinimumF().second, 1.0);
+
+    interp.scaleData(-1.0);
+    BOOST_CHECK (interp.isStrictlyDecreasing());
+    BOOST_CHECK_EQUAL (interp.evaluate(1.5), -2.5);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -86,3 +86,28 @@ BOOST_AUTO_TEST_CASE(table_operations)
     BOOST_CHECK_EQUAL(t1(0.0), 3.0);
     BOOST_CHECK(std::fabs(t1.derivative(0.0)  + 1.0/20.0) < 1e-11);
 }
+
+BOOST_AUTO_TEST_CASE(batch_evaluation)
+{
+    double xva[] = { -1.0, 2.0, 2.2, 3.0, 5.0, 5.0, 7.5 };
+    const int numvals = sizeof(xva)/sizeof(xva[0]);
+    std::vector<double> xv(xva, xva + numvals);
+    double yva[numvals] = { 1.0, 2.0, 3.0, 4.0, 2.0, 2.5, 0.0 };
+    std::vector<double> yv(yva, yva + numvals);
+    Opm::NonuniformTableLinear<double> t1(xv, yv);
+
+    // Include points outside the domain (extrapolated) and every data point.
+    std::vector<double> x(xv);
+    for (int i = -30; i <= 100; ++i) {
+        x.push_back(0.1*i);
+    }
+
+    const std::vector<double> y = t1.evaluate(x);
+    const std::vector<double> dy = t1.derivative(x);
+    BOOST_REQUIRE_EQUAL(y.size(), x.size());
+    BOOST_REQUIRE_EQUAL(dy.size(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+        BOOST_CHECK_EQUAL(y[i], t1(x[i]));
+        BOOST_CHECK_EQUAL(dy[i], t1.derivative(x[i]));
+    }
+}
@@ -27,6 +27,8 @@
 #include <opm/parser/eclipse/Deck/Deck.hpp>
 #include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/TimeMap.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Well.hpp>
 #include <opm/output/eclipse/RegionCache.hpp>
 #include <opm/parser/eclipse/Parser/ParseContext.hpp>
 #include <opm/parser/eclipse/Parser/Parser.hpp>
@@ -47,18 +49,39 @@ BOOST_AUTO_TEST_CASE(create) {
     Schedule schedule( deck, grid, es.get3DProperties(), es.runspec().phases(), ParseContext() );
     out::RegionCache rc(es.get3DProperties() , grid, schedule);
 
+    const auto& wells = schedule.getWells();
+    const auto last_step = schedule.getTimeMap().last();
     {
-        const auto& empty = rc.connections( 4 );
+        const auto empty = rc.connections( 4 , 0 );
         BOOST_CHECK_EQUAL( empty.size() , 0 );
+        BOOST_CHECK( rc.connections( 100 , 0 ).empty() );
     }
 
     {
-        const auto& top_layer = rc.connections( 1 );
+        const auto top_layer = rc.connections( 1 , 0 );
         BOOST_CHECK_EQUAL( top_layer.size() , 3 );
         {
-            auto pair = top_layer[0];
-            BOOST_CHECK_EQUAL( pair.first , "W_1");
-            BOOST_CHECK_EQUAL( pair.second , grid.activeIndex( 0,0,0));
+            const auto& connection = top_layer[0];
+            BOOST_CHECK_EQUAL( wells[ connection.well ]->name() , "W_1");
+            BOOST_CHECK_EQUAL( connection.connection , 0 );
+            BOOST_CHECK_EQUAL( connection.active_index , grid.activeIndex( 0,0,0));
         }
+        BOOST_CHECK_EQUAL( rc.connections( 1 , last_step ).size() , 3 );
+    }
+
+    {
+        const auto& connection = rc.connections( 2 , 0 )[0];
+        BOOST_CHECK_EQUAL( wells[ connection.well ]->name() , "W_2");
+        BOOST_CHECK_EQUAL( connection.connection , 1 );
+    }
+
+    /* W_4 is completed in the third layer at report step 2. */
+    {
+        BOOST_CHECK( rc.connections( 3 , 1 ).empty() );
+        const auto third_layer = rc.connections( 3 , 2 );
+        BOOST_CHECK_EQUAL( third_layer.size() , 1 );
+        BOOST_CHECK_EQUAL( wells[ third_layer[0].well ]->name() , "W_4");
+        BOOST_CHECK_EQUAL( rc.connections( 3 , last_step ).size() , 1 );
+        BOOST_CHECK_EQUAL( rc.connections( 3 , last_step + 10 ).size() , 1 );
     }
 }
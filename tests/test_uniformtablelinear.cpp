@@ -68,3 +68,28 @@ BOOST_AUTO_TEST_CASE(table_operations)
     BOOST_CHECK_EQUAL(t1(-85.0), 0.0);
     BOOST_CHECK(std::fabs(t1.derivative(0.0)  + 2.0/30.0) < 1e-14);
 }
+
+BOOST_AUTO_TEST_CASE(batch_evaluation)
+{
+    double yva[] = { 1.0, -1.0, 3.0, 4.0, 2.0 };
+    const int numvals = sizeof(yva)/sizeof(yva[0]);
+    std::vector<double> yv(yva, yva + numvals);
+    Opm::utils::UniformTableLinear<double> t1(1.0, 11.0, yv);
+
+    // Include points outside the domain, the end points and every data point.
+    std::vector<double> x;
+    for (int i = -10; i <= 130; ++i) {
+        x.push_back(0.1*i);
+    }
+
+    const std::vector<double> y = t1.evaluate(x);
+    const std::vector<double> dy = t1.derivative(x);
+    BOOST_REQUIRE_EQUAL(y.size(), x.size());
+    BOOST_REQUIRE_EQUAL(dy.size(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+        BOOST_CHECK_EQUAL(y[i], t1(x[i]));
+        BOOST_CHECK_EQUAL(dy[i], t1.derivative(x[i]));
+    }
+    BOOST_CHECK_EQUAL(t1.evaluate(std::vector<double>{ 11.0 })[0], yv.back());
+    BOOST_CHECK(t1.evaluate(std::vector<double>()).empty());
+}